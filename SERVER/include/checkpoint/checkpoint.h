@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** checkpoint
+*/
+
+#ifndef CHECKPOINT
+    #define CHECKPOINT
+
+    #include <stdint.h>
+    #include "server.h"
+
+    #define CHECKPOINT_MAGIC "ZAPPYCKP"
+    #define CHECKPOINT_VERSION 2
+    #define CHECKPOINT_DEFAULT_PATH "zappy.ckp"
+
+typedef struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t team_size;
+    uint32_t chunk_size;
+    uint32_t egg_size;
+    uint32_t player_size;
+    uint32_t action_queue_size;
+    uint32_t action_arena_size;
+    int32_t width;
+    int32_t height;
+    int32_t freq;
+    int32_t num_teams;
+    int32_t next_egg_id;
+    int32_t player_count;
+    int32_t egg_count;
+    uint32_t chunk_count;
+    uint64_t seed;
+    uint64_t tick;
+    uint64_t next_respawn_tick;
+    rng_t rng;
+    int64_t totals[RESOURCE_COUNT];
+} checkpointheader_t;
+
+typedef struct CheckpointTeam {
+    char name[MAX_TEAM_NAME];
+    int32_t max_clients;
+} checkpointteam_t;
+
+typedef struct CheckpointChunk {
+    uint64_t chunk_id;
+    tilecount_t resources[RESOURCE_COUNT][CHUNK_TILES];
+} checkpointchunk_t;
+
+typedef struct CheckpointEgg {
+    int32_t id;
+    int32_t parent_id;
+    int32_t team_id;
+    int32_t x;
+    int32_t y;
+    int32_t reserved;
+} checkpointegg_t;
+
+typedef struct CheckpointPlayer {
+    int32_t x;
+    int32_t y;
+    int32_t orientation;
+    int32_t level;
+    int32_t team_id;
+    int32_t ritual;
+    uint64_t starve_tick;
+    int32_t inventory[RESOURCE_COUNT];
+    actionqueue_t actions;
+} checkpointplayer_t;
+
+size_t get_checkpoint_size(const checkpointheader_t *header);
+int save_checkpoint(server_t *server, const char *path);
+int restore_checkpoint(server_t *server, const char *path);
+int restore_players(server_t *server, const checkpointplayer_t *records,
+    int count);
+void request_checkpoint(int signum);
+void process_checkpoint_request(server_t *server);
+int write_checkpoint(server_t *server);
+
+#endif
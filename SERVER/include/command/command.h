@@ -13,31 +13,86 @@
     #include "../player.h"
     #include <sys/types.h>
     #include <sys/socket.h>
+    #include <stdbool.h>
+
+    #define LOOK_LEVEL_MAX 8
+    #define LOOK_CELLS_MAX ((LOOK_LEVEL_MAX + 1) * (LOOK_LEVEL_MAX + 1))
+    #define BROADCAST_DIRECTIONS 9
 
 typedef struct Player player_t;
 typedef struct Server server_t;
+typedef struct SharedBuffer sharedbuf_t;
+
+typedef enum {
+    CMD_FORWARD,
+    CMD_RIGHT,
+    CMD_LEFT,
+    CMD_LOOK,
+    CMD_INVENTORY,
+    CMD_BROADCAST,
+    CMD_CONNECT_NBR,
+    CMD_FORK,
+    CMD_EJECT,
+    CMD_TAKE,
+    CMD_SET,
+    CMD_INCANTATION,
+    CMD_ELEVATION,
+    CMD_UNKNOWN,
+    CMD_COUNT
+} opcode_t;
+
+typedef struct {
+    player_t *sender;
+    const char *text;
+    size_t text_len;
+    sharedbuf_t *messages[BROADCAST_DIRECTIONS];
+} broadcast_t;
+
+typedef void (*commandhandler_t)(player_t *player, server_t *server,
+    const char *arg, char *response);
 
 typedef struct {
     const char *name;
+    size_t name_len;
     int duration;
-} commandduration_t;
+    bool has_arg;
+    commandhandler_t handler;
+} commanddef_t;
 
-int get_command_duration(const char *command);
-void move_player_forward(player_t *player, server_t *server);
-void handle_inventory_command(player_t *player, char *response);
-void handle_set_command(player_t *player, server_t *server,
-    const char *command, char *reponse);
-void handle_take_command(player_t *player, server_t *server,
-    const char *command, char *reponse);
-void handle_eject_command(player_t *player, server_t *server, char *reponse);
-void handle_broadcast_command(player_t *player, server_t *server, const char *
-    command, char *reponse);
-void handle_incantation_command(player_t *player, server_t *server,
-    char *reponse);
-void handle_fork_command(player_t *player, server_t *server, char *reponse);
+opcode_t parse_command(const char *line, const char **arg);
+int get_command_duration(opcode_t opcode);
+const char *get_command_name(opcode_t opcode);
 void process_player_command(player_t *player, server_t *server,
-    const char *command);
-void handle_look_command(player_t *player, server_t *server, char *response);
-void prepare_incantation(player_t *player, server_t *server, char *response);
-void finish_incantation(player_t *player, server_t *server);
+    opcode_t opcode, const char *arg);
+bool move_player_forward(player_t *player, server_t *server);
+void handle_forward_command(player_t *player, server_t *server,
+    const char *arg, char *response);
+void handle_right_command(player_t *player, server_t *server,
+    const char *arg, char *response);
+void handle_left_command(player_t *player, server_t *server,
+    const char *arg, char *response);
+void handle_look_command(player_t *player, server_t *server,
+    const char *arg, char *response);
+void handle_inventory_command(player_t *player, server_t *server,
+    const char *arg, char *response);
+void handle_broadcast_command(player_t *player, server_t *server,
+    const char *text, char *response);
+int calculate_sound_direction(server_t *server, player_t *sender,
+    player_t *receiver);
+void handle_player_broadcast(server_t *server, player_t *sender,
+    const char *text);
+void handle_fork_command(player_t *player, server_t *server,
+    const char *arg, char *response);
+void handle_eject_command(player_t *player, server_t *server,
+    const char *arg, char *response);
+void handle_take_command(player_t *player, server_t *server,
+    const char *item, char *response);
+void handle_set_command(player_t *player, server_t *server,
+    const char *item, char *response);
+void prepare_incantation(player_t *player, server_t *server,
+    const char *arg, char *response);
+void finish_incantation(player_t *player, server_t *server,
+    const char *arg, char *response);
+void leave_incantation(server_t *server, player_t *player);
+void join_incantation(player_t *leader, player_t *player);
 #endif
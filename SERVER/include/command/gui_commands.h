@@ -31,6 +31,7 @@ void handle_gui_ppo(server_t *server, int client_socket, int player_id);
 void handle_gui_plv(server_t *server, int client_socket, int player_id);
 void handle_gui_pin(server_t *server, int client_socket, int player_id);
 void handle_gui_sgt(server_t *server, int client_socket);
+void handle_gui_ckp(server_t *server, int client_socket, const char *token);
 
 void handle_gui_sst(server_t *server, int client_socket, int new_freq);
 void send_gui_pnw(server_t *server, int player_id);
@@ -40,7 +41,6 @@ void send_gui_pic(server_t *server, player_t *player);
 void send_gui_pie(server_t *server, int x, int y, int result);
 void send_gui_pfk(server_t *server, int player_id);
 void send_gui_pdr(server_t *server, int player_id, int resource);
-void send_to_gui_client(int socket, const char *message);
 void send_gui_pgt(server_t *server, int player_id, int resource);
 void send_gui_pdi(server_t *server, int player_id);
 void send_gui_enw(server_t *server, int egg_id, int player_id, position_t pos);
@@ -54,8 +54,6 @@ int get_resource_id(const char *resource_name);
 void process_gui_command(server_t *server, int client_socket, char *command);
 
 void broadcast_to_gui_clients(server_t *server, const char *message);
-void send_to_gui_client(int socket, const char *message);
-void handle_player_broadcast(server_t *server, int sender_id,
-    const char *text);
+void send_to_gui_client(server_t *server, int socket, const char *message);
 
 #endif /* !GUI_COMMANDS_H_ */
@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** egg.h
+*/
+
+#ifndef EGG
+    #define EGG
+
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include "command/gui_commands.h"
+
+typedef struct Egg {
+    int id;
+    int parent_id;
+    int team_id;
+    int x;
+    int y;
+    size_t tile;
+    struct Egg *team_prev;
+    struct Egg *team_next;
+    struct Egg *tile_prev;
+    struct Egg *tile_next;
+} egg_t;
+
+egg_t *egg_alloc(server_t *server);
+void egg_release(server_t *server, egg_t *egg);
+int init_eggs(server_t *server);
+void free_eggs(server_t *server);
+egg_t *lay_egg(server_t *server, int team_id, int parent_id,
+    position_t pos);
+bool hatch_egg(server_t *server, int team_id, position_t *pos);
+int destroy_tile_eggs(server_t *server, size_t tile);
+void send_eggs_info(server_t *server, int graphic_fd);
+
+#endif
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** journal
+*/
+
+#ifndef JOURNAL
+    #define JOURNAL
+
+    #include <stdint.h>
+    #include "server.h"
+
+    #define JOURNAL_MAGIC "ZAPPYJNL"
+    #define JOURNAL_VERSION 1
+    #define JOURNAL_FLUSH_SIZE 65536
+
+typedef enum JournalRecord {
+    JOURNAL_TICK,
+    JOURNAL_STEP,
+    JOURNAL_JOIN,
+    JOURNAL_COMMAND,
+    JOURNAL_LEAVE,
+    JOURNAL_SPECTATE,
+    JOURNAL_GUI,
+    JOURNAL_RECORD_COUNT
+} journalrecord_t;
+
+typedef struct JournalHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t restored;
+    int32_t width;
+    int32_t height;
+    int32_t freq;
+    int32_t clients_nb;
+    int32_t num_teams;
+    uint64_t seed;
+    uint64_t start_tick;
+    char teams[MAX_TEAMS][MAX_TEAM_NAME];
+} journalheader_t;
+
+typedef struct Journal {
+    int fd;
+    size_t size;
+    writer_t buffer;
+    uint64_t tick;
+    uint64_t flushed_tick;
+} journal_t;
+
+typedef struct Replay {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+    size_t records;
+    bool failed;
+    uint64_t slowest_ns;
+    uint64_t slowest_tick;
+} replay_t;
+
+int open_journal(server_t *server, const char *path);
+void close_journal(server_t *server);
+void journal_tick(server_t *server, uint64_t tick);
+void journal_event(server_t *server, journalrecord_t type, int slot);
+void journal_join(server_t *server, int socket, int team_id, int slot);
+void journal_text(server_t *server, journalrecord_t type, int slot,
+    const char *text);
+void apply_journal_record(server_t *server, replay_t *replay);
+int replay_journal(server_t *server);
+
+#endif
@@ -8,25 +8,111 @@
 
 #ifndef MAP
     #define MAP
+    #include <pthread.h>
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
     #include "../player.h"
+    #include "../utils/random.h"
 
-typedef struct List list_t;
-struct List {
-    player_t *player;
-    list_t *next;
-};
+    #define RESOURCE_COUNT 7
+    #define LEVEL_MAX 8
+    #define MAP_ALIGNMENT 64
+    #define MAP_SIZE_MAX 100000
+    #define CHUNK_SHIFT 5
+    #define CHUNK_SIZE (1 << CHUNK_SHIFT)
+    #define CHUNK_TILES (CHUNK_SIZE * CHUNK_SIZE)
+    #define CHUNK_MASK (CHUNK_TILES - 1)
+    #define DIRTY_WORDS (CHUNK_TILES / 64)
+    #define CHUNK_ALLOC_SIZE ((sizeof(mapchunk_t) + MAP_ALIGNMENT - 1) \
+        & ~(size_t)(MAP_ALIGNMENT - 1))
+    #define TILE_COUNT_MAX UINT16_MAX
+    #define TILE_FRAGMENT_MAX 50
+    #define TILE_FRAGMENT_CACHE 4096
+    #define MAP_EAGER_CHUNKS 1024
+    #define GENERATION_THREADS_MAX 16
+    #define GENERATION_CHUNKS_MIN 32
 
-typedef struct {
-    int *resources;
-    list_t *players_on_tile;
-} tile_t;
+typedef uint16_t tilecount_t;
+typedef struct Egg egg_t;
+
+typedef struct TileFragment {
+    size_t tile;
+    uint32_t version;
+    uint16_t len;
+    char text[TILE_FRAGMENT_MAX];
+} tilefragment_t;
+
+typedef struct MapChunk {
+    tilecount_t resources[RESOURCE_COUNT][CHUNK_TILES];
+    player_t *occupants[CHUNK_TILES];
+    egg_t *eggs[CHUNK_TILES];
+    uint32_t versions[CHUNK_TILES];
+    uint16_t occupant_count[CHUNK_TILES];
+    uint16_t levels[LEVEL_MAX][CHUNK_TILES];
+    uint64_t dirty[DIRTY_WORDS];
+    bool dirty_listed;
+} mapchunk_t;
+
+typedef struct Writer writer_t;
 
 typedef struct {
     int width;
     int height;
-    tile_t **tiles;
+    int chunks_w;
+    int chunks_h;
+    size_t tile_count;
+    size_t chunk_count;
+    mapchunk_t **chunks;
+    size_t *live_chunks;
+    size_t live_count;
+    size_t live_capacity;
+    size_t materialized_tiles;
+    size_t *dirty_chunks;
+    size_t dirty_count;
+    size_t dirty_capacity;
+    uint64_t seed;
+    int64_t totals[RESOURCE_COUNT];
+    tilefragment_t *fragments;
+    mapchunk_t *scratch;
+    size_t scratch_id;
 } map_t;
 
-void init_map(server_t *server);
+typedef struct GenerationWorker {
+    pthread_t thread;
+    map_t *map;
+    size_t first;
+    size_t count;
+    int64_t totals[RESOURCE_COUNT];
+} generationworker_t;
+
+int init_map(server_t *server);
+void free_map(map_t *map);
+int wrap_coord(int value, int size);
+size_t get_tile_at(map_t *map, int x, int y);
+size_t get_tile_index(map_t *map, int x, int y);
+mapchunk_t *get_chunk(map_t *map, size_t tile);
+mapchunk_t *generate_chunk(map_t *map, size_t chunk_id, int64_t *totals);
+void fill_chunk(map_t *map, size_t chunk_id, mapchunk_t *chunk,
+    int64_t *totals);
+const mapchunk_t *peek_chunk(map_t *map, size_t chunk_id);
+int reserve_live_chunks(map_t *map, size_t extra);
+int materialize_map(map_t *map);
+void get_chunk_extent(map_t *map, size_t chunk_id, int *width, int *height);
+void adopt_chunk(map_t *map, size_t chunk_id, mapchunk_t *chunk);
+int get_tile_resource(map_t *map, size_t tile, int type);
+bool tile_add_resource(map_t *map, size_t tile, int type, int delta);
+player_t *get_tile_players(map_t *map, size_t tile);
+int get_tile_player_count(map_t *map, size_t tile);
+void add_player_to_tile(map_t *map, size_t tile, player_t *player);
+void remove_player_from_tile(map_t *map, player_t *player);
+bool place_player(map_t *map, player_t *player, int x, int y);
+void set_player_level(map_t *map, player_t *player, int level);
+int get_tile_level_count(map_t *map, size_t tile, int level);
+void add_egg_to_tile(map_t *map, size_t tile, egg_t *egg);
+void remove_egg_from_tile(map_t *map, egg_t *egg);
+void mark_tile_dirty(map_t *map, mapchunk_t *chunk, size_t tile);
+void flush_dirty_tiles(server_t *server);
+void append_tile_text(map_t *map, size_t tile, writer_t *out);
 
 #endif
@@ -9,8 +9,6 @@
     #define RESOURCE
     #include "map.h"
 
-    #define RESOURCE_COUNT 7
-
 enum Orientation {
     NORTH,
     EAST,
@@ -28,10 +26,13 @@ typedef enum {
     THYSTAME
 } resourcetype_t;
 
-void init_ressources(map_t *map);
-void respawn_resource(map_t *map);
-void add_player_to_tile(tile_t *tile, player_t *player);
-void remove_player_from_tile(tile_t *tile, player_t *player);
-tile_t *get_tile(map_t *map, int x, int y);
+typedef struct Elevation {
+    int players;
+    int resources[RESOURCE_COUNT];
+} elevation_t;
+
+extern const double RESOURCE_DENSITY[RESOURCE_COUNT];
+
+void respawn_resource(map_t *map, rng_t *rng);
 
 #endif
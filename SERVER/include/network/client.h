@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** client.h
+*/
+
+#ifndef CLIENT
+    #define CLIENT
+
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <sys/types.h>
+
+    #define CLIENT_INPUT_SIZE 8192
+    #define CLIENT_INPUT_MASK (CLIENT_INPUT_SIZE - 1)
+    #define CLIENT_CHUNK_SIZE 16384
+    #define CLIENT_IOV_MAX 64
+    #define CLIENT_OUTPUT_HIGH_WATER (4 * 1024 * 1024)
+    #define SHARED_BUFFER_SIZE 4096
+    #define CLIENT_SHARE_MIN 256
+
+typedef struct Server server_t;
+
+typedef enum {
+    CLIENT_PENDING,
+    CLIENT_AI,
+    CLIENT_GRAPHIC
+} clienttype_t;
+
+typedef struct SharedBuffer {
+    int refs;
+    size_t len;
+    size_t cap;
+    char data[];
+} sharedbuf_t;
+
+typedef struct OutputChunk {
+    struct OutputChunk *next;
+    sharedbuf_t *shared;
+    size_t len;
+    size_t cap;
+    char data[];
+} outchunk_t;
+
+typedef struct Client {
+    int fd;
+    clienttype_t type;
+    int player;
+    char in_buf[CLIENT_INPUT_SIZE];
+    size_t in_head;
+    size_t in_len;
+    size_t in_scan;
+    bool in_overflow;
+    outchunk_t *out_head;
+    outchunk_t *out_tail;
+    size_t out_offset;
+    size_t out_pending;
+    bool out_armed;
+    bool closing;
+    bool in_dirty;
+    size_t snapshot_next;
+    size_t snapshot_end;
+    size_t snapshot_repeats;
+    struct Client *next_dirty;
+    struct Client *next_spectator;
+    struct Client *prev_spectator;
+} client_t;
+
+client_t *client_create(server_t *server, int fd);
+client_t *client_get(server_t *server, int fd);
+void client_drop_output(client_t *client);
+void client_destroy(server_t *server, client_t *client);
+void client_destroy_all(server_t *server);
+ssize_t client_read(client_t *client);
+bool client_next_line(client_t *client, char *line);
+void client_send(server_t *server, int fd, const char *data, size_t len);
+int client_queue_shared(server_t *server, client_t *client,
+    sharedbuf_t *buffer);
+void client_send_shared(server_t *server, client_t *client,
+    sharedbuf_t *buffer);
+void client_mark_dirty(server_t *server, client_t *client);
+void client_close(server_t *server, client_t *client);
+int client_flush(server_t *server, client_t *client);
+sharedbuf_t *sharedbuf_create(size_t cap);
+int sharedbuf_append(sharedbuf_t **buffer, const char *data, size_t len);
+void sharedbuf_release(sharedbuf_t *buffer);
+void outchunk_free(outchunk_t *chunk);
+
+#endif
@@ -0,0 +1,24 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** poll.h
+*/
+
+#ifndef POLL
+    #define POLL
+
+    #include <sys/epoll.h>
+    #include <stdbool.h>
+
+    #define MAX_EVENTS 256
+
+typedef struct Server server_t;
+
+int poll_init(server_t *server);
+int poll_add(server_t *server, int fd, void *data);
+int poll_set_writable(server_t *server, int fd, void *data, bool writable);
+void poll_remove(server_t *server, int fd);
+int poll_wait(server_t *server, struct epoll_event *events, int timeout);
+
+#endif
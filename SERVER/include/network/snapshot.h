@@ -0,0 +1,20 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** snapshot.h
+*/
+
+#ifndef SNAPSHOT
+    #define SNAPSHOT
+
+    #include "network/client.h"
+
+    #define SNAPSHOT_LOW_WATER (256 * 1024)
+
+typedef struct Server server_t;
+
+void snapshot_start(server_t *server, client_t *client);
+void snapshot_pump(server_t *server, client_t *client);
+
+#endif
@@ -0,0 +1,22 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** spectator.h
+*/
+
+#ifndef SPECTATOR
+    #define SPECTATOR
+
+    #include <stddef.h>
+    #include "network/client.h"
+
+typedef struct Server server_t;
+
+void spectator_add(server_t *server, client_t *client);
+void spectator_remove(server_t *server, client_t *client);
+void spectator_broadcast(server_t *server, const char *data, size_t len);
+void spectator_publish(server_t *server);
+void spectator_destroy_all(server_t *server);
+
+#endif
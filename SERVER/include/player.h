@@ -29,22 +29,45 @@ typedef struct Player {
     int socket;
     char team_name[MAX_TEAM_NAME];
     time_t last_action;
-    action_t *action_queue;
-    bool is_incanting;
-    bool is_waiting_level_up;
+    uint64_t starve_tick;
+    uint64_t dormant_tick;
+    struct Player *dormant_prev;
+    struct Player *dormant_next;
+    actionqueue_t actions;
+    struct Player *ritual;
+    struct Player *ritual_prev;
+    struct Player *ritual_next;
+    bool active;
+    unsigned int generation;
+    int slot;
+    int live_index;
+    int next_free;
+    bool on_tile;
+    size_t tile;
+    struct Player *tile_prev;
+    struct Player *tile_next;
 } player_t;
 
 typedef struct player_init_s {
     int socket;
     int team_id;
     const char *team_name;
+    int x;
+    int y;
 } player_init_t;
 
 void init_player(player_t *player, player_init_t config, server_t *server);
 void set_player_resources(player_t *player);
 int find_player_by_socket(server_t *server, int socket);
 void remove_player(server_t *server, int player_index);
-void move_player_forward(player_t *player, server_t *server);
-void move_player_direction(player_t *player, server_t *server, int dir);
+uint64_t get_player_clock(server_t *server, player_t *player);
+void shift_player_ticks(player_t *player, uint64_t delay);
+bool move_player_forward(player_t *player, server_t *server);
+bool move_player_direction(player_t *player, server_t *server, int dir);
 void send_player_info(server_t *server, int graphic_fd);
+int init_player_pool(server_t *server);
+player_t *player_alloc(server_t *server);
+void player_release(server_t *server, player_t *player);
+int get_player_id(player_t *player);
+player_t *get_player_by_id(server_t *server, int id);
 #endif
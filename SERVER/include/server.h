@@ -9,7 +9,7 @@
     #define SERVER_H
 
     #define MAX_TEAMS 10
-    #define MAX_CLIENTS 100
+    #define MAX_CLIENTS 1024
     #define MAX_TEAM_NAME 50
 
     #include "player.h"
@@ -22,35 +22,66 @@
     #include <sys/types.h>
     #include <netinet/in.h>
     #include <arpa/inet.h>
-    #include <sys/select.h>
+    #include <sys/epoll.h>
     #include <time.h>
+    #include <stdint.h>
     #include "utils/action.h"
     #include "map/map.h"
+    #include "network/client.h"
+    #include "utils/heap.h"
+    #include "utils/writer.h"
+    #include "utils/random.h"
     #include "math.h"
 
+typedef struct Journal journal_t;
+
 typedef struct Server {
     int width, height;
     int port;
     int freq;
+    uint64_t seed;
+    rng_t rng;
     team_t teams[MAX_TEAMS];
     int num_teams;
-    player_t players[MAX_CLIENTS];
+    player_t *players;
+    int *live_players;
     int num_players;
+    int free_player;
     int server_socket;
-    fd_set master_fds;
-    int max_fd;
-    time_t last_tick;
-    int tick_count;
-    int graphic_fd;
+    int epoll_fd;
+    client_t **clients;
+    int clients_cap;
+    client_t *dirty_clients;
+    uint64_t tick_origin_ns;
+    uint64_t tick_origin;
+    uint64_t tick_count;
+    uint64_t next_respawn_tick;
+    uint64_t last_dirty_flush;
+    heap_t action_timers;
+    heap_t starvation;
+    client_t *spectators;
+    int spectator_count;
+    sharedbuf_t *gui_events;
+    writer_t scratch;
     map_t *map;
     int next_egg_id;
+    int winner;
+    const char *restore_path;
+    const char *checkpoint_path;
+    const char *journal_path;
+    const char *replay_path;
+    const char *admin_token;
+    journal_t *journal;
+    egg_t *free_eggs;
 } server_t;
 
 int parse_arguments(int argc, char **argv, server_t *server);
-void init_fd_sets(server_t *server);
+int init_event_loop(server_t *server);
+int init_world(server_t *server);
+int init_state(server_t *server);
 int init_server(server_t *server);
-void check_new_connections(server_t *server, fd_set *read_fds);
-void check_client_messages(server_t *server, fd_set *read_fds);
+void handle_poll_event(server_t *server, struct epoll_event *event);
+void flush_clients(server_t *server);
 void send_connection_info(server_t *server, int client_socket, int team_id);
 void cleanup_server(server_t *server);
 void run_server(server_t *server);
@@ -8,6 +8,8 @@
 #ifndef TEAM
     #define TEAM
     #define MAX_TEAM_NAME 50
+    #define WIN_PLAYERS 6
+    #define END_DRAIN_TIMEOUT_MS 2000
     #include <stdio.h>
     #include <string.h>
     #include <unistd.h>
@@ -15,15 +17,29 @@
 
 
 typedef struct Server server_t;
+typedef struct Egg egg_t;
+typedef struct Player player_t;
 typedef struct Team {
     char name[MAX_TEAM_NAME];
     int max_clients;
     int current_clients;
+    egg_t *eggs;
+    int egg_count;
+    int max_level_players;
+    player_t *dormant;
+    int dormant_count;
 } team_t;
 
 void add_team_name(server_t *server, const char *name);
 void parse_team_names(server_t *server, char *first_name, char **argv);
 void set_team_max_clients(server_t *server, int clients_nb);
+void raise_player_level(server_t *server, player_t *player);
+void forget_player_level(server_t *server, player_t *player);
+void end_game(server_t *server);
+void add_dormant_player(server_t *server, player_t *player);
+void remove_dormant_player(server_t *server, player_t *player);
+player_t *wake_dormant_player(server_t *server, int team_id,
+    int client_socket);
 void handle_team_join_success(server_t *server, int client_socket, int team_id,
     const char *team_name);
 void handle_team_authentication(server_t *server, int client_socket, const char
@@ -0,0 +1,24 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** life.h
+*/
+
+#ifndef LIFE
+    #define LIFE
+
+    #include <stdint.h>
+
+    #define FOOD_TICKS 126
+
+typedef struct Server server_t;
+typedef struct Player player_t;
+
+void feed_player(server_t *server, player_t *player, int units);
+int get_player_food(server_t *server, player_t *player);
+void cancel_starvation(server_t *server, player_t *player);
+void process_starvation(server_t *server);
+uint64_t next_starvation_tick(server_t *server);
+
+#endif
@@ -8,6 +8,22 @@
 #ifndef TICK
     #define TICK
 
+    #include <stdint.h>
+
+    #define NS_PER_SEC 1000000000ULL
+    #define NS_PER_MS 1000000ULL
+    #define RESPAWN_INTERVAL 20
+    #define MAX_POLL_TIMEOUT_MS 1000
+
+typedef struct Server server_t;
+
+uint64_t clock_now_ns(void);
+void tick_init(server_t *server);
+void tick_resume(server_t *server, uint64_t tick);
+uint64_t tick_sample(server_t *server);
+uint64_t tick_now(server_t *server);
+void tick_set_freq(server_t *server, int freq);
+int tick_timeout(server_t *server);
 void update_ticks(server_t *server);
 
 #endif
@@ -11,18 +11,42 @@
     #include "time.h"
     #include <stdio.h>
     #include <math.h>
+    #include <stdint.h>
     #define BUFFER_SIZE 1024
+    #define MAX_PENDING_ACTIONS 10
+    #define ACTION_QUEUE_SIZE 16
+    #define ACTION_QUEUE_MASK (ACTION_QUEUE_SIZE - 1)
+    #define ACTION_ARENA_SIZE 8192
 
 typedef struct Server server_t;
 typedef struct Player player_t;
 
 typedef struct Action {
-    char command[32];
+    uint64_t end_tick;
     int duration;
-    time_t end_time;
-    struct Action *next;
+    int opcode;
+    unsigned int offset;
+    unsigned int length;
 } action_t;
 
+typedef struct ActionQueue {
+    action_t slots[ACTION_QUEUE_SIZE];
+    int head;
+    int count;
+    unsigned int arena_tail;
+    char arena[ACTION_ARENA_SIZE];
+} actionqueue_t;
+
 void process_pending_action(server_t *server);
-void add_action_to_queue(player_t *player, const char *command, int freq);
+void add_action_to_queue(server_t *server, player_t *player,
+    const char *command);
+uint64_t next_action_tick(server_t *server);
+void clear_player_actions(server_t *server, player_t *player);
+void continue_action(player_t *player, int opcode);
+action_t *action_queue_push(actionqueue_t *queue, int opcode,
+    const char *arg);
+action_t *action_queue_front(actionqueue_t *queue);
+action_t *action_queue_back(actionqueue_t *queue);
+void action_queue_pop(actionqueue_t *queue);
+const char *action_payload(actionqueue_t *queue, action_t *action);
 #endif
@@ -0,0 +1,22 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** format.h
+*/
+
+#ifndef FORMAT
+    #define FORMAT
+
+    #include <stddef.h>
+    #include "map/map.h"
+
+    #define UINT_DIGITS_MAX 10
+    #define BCT_LINE_MAX (4 + 9 * (UINT_DIGITS_MAX + 1))
+
+size_t format_uint(char *buffer, unsigned int value);
+size_t format_bct(char *buffer, const mapchunk_t *chunk, int x, int y);
+size_t format_chunk(map_t *map, size_t chunk_id, const mapchunk_t *chunk,
+    char *buffer);
+
+#endif
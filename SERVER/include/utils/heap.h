@@ -0,0 +1,34 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** heap.h
+*/
+
+#ifndef HEAP
+    #define HEAP
+
+    #include <stdint.h>
+    #include <stdbool.h>
+
+typedef struct HeapEntry {
+    uint64_t key;
+    uint64_t seq;
+    int id;
+} heapentry_t;
+
+typedef struct Heap {
+    heapentry_t *entries;
+    int *positions;
+    int size;
+    int capacity;
+    uint64_t next_seq;
+} heap_t;
+
+int heap_init(heap_t *heap, int capacity);
+void heap_destroy(heap_t *heap);
+void heap_set(heap_t *heap, int id, uint64_t key);
+void heap_remove(heap_t *heap, int id);
+int heap_pop_due(heap_t *heap, uint64_t now);
+
+#endif
@@ -0,0 +1,16 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** mapped_file
+*/
+
+#ifndef MAPPED_FILE
+    #define MAPPED_FILE
+
+    #include <stddef.h>
+
+const void *map_file(const char *path, size_t *size);
+void unmap_file(const void *data, size_t size);
+
+#endif
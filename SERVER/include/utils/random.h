@@ -0,0 +1,22 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** random.h
+*/
+
+#ifndef RANDOM
+    #define RANDOM
+
+    #include <stdint.h>
+
+typedef struct Rng {
+    uint64_t state[4];
+} rng_t;
+
+uint64_t splitmix64(uint64_t *state);
+void rng_seed(rng_t *rng, uint64_t seed);
+uint64_t rng_next(rng_t *rng);
+uint32_t rng_below(rng_t *rng, uint32_t bound);
+
+#endif
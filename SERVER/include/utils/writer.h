@@ -0,0 +1,28 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** writer.h
+*/
+
+#ifndef WRITER
+    #define WRITER
+
+    #include <stddef.h>
+    #include <stdbool.h>
+
+    #define WRITER_INITIAL_SIZE 4096
+
+typedef struct Writer {
+    char *data;
+    size_t len;
+    size_t cap;
+    bool failed;
+} writer_t;
+
+char *writer_reserve(writer_t *writer, size_t len);
+void writer_append(writer_t *writer, const char *data, size_t len);
+void writer_reset(writer_t *writer);
+void writer_free(writer_t *writer);
+
+#endif
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** restore.c
+*/
+
+#include "checkpoint/checkpoint.h"
+#include "utils/mapped_file.h"
+#include "time/tick.h"
+#include "egg.h"
+
+static bool valid_layout(const checkpointheader_t *header)
+{
+    return memcmp(header->magic, CHECKPOINT_MAGIC,
+        sizeof(header->magic)) == 0 &&
+        header->version == CHECKPOINT_VERSION &&
+        header->header_size == sizeof(checkpointheader_t) &&
+        header->team_size == sizeof(checkpointteam_t) &&
+        header->chunk_size == sizeof(checkpointchunk_t) &&
+        header->egg_size == sizeof(checkpointegg_t) &&
+        header->player_size == sizeof(checkpointplayer_t) &&
+        header->action_queue_size == ACTION_QUEUE_SIZE &&
+        header->action_arena_size == ACTION_ARENA_SIZE;
+}
+
+static bool valid_header(const checkpointheader_t *header, size_t size)
+{
+    if (!valid_layout(header))
+        return false;
+    if (header->width < 1 || header->width > MAP_SIZE_MAX ||
+        header->height < 1 || header->height > MAP_SIZE_MAX ||
+        header->freq < 1 || header->num_teams < 1 ||
+        header->num_teams > MAX_TEAMS || header->egg_count < 0 ||
+        header->player_count < 0 || header->player_count > MAX_CLIENTS)
+        return false;
+    return get_checkpoint_size(header) == size;
+}
+
+static void apply_header(server_t *server, const checkpointheader_t *header)
+{
+    const checkpointteam_t *teams = (const checkpointteam_t *)(header + 1);
+
+    server->width = header->width;
+    server->height = header->height;
+    server->freq = header->freq;
+    server->seed = header->seed;
+    server->rng = header->rng;
+    server->num_teams = 0;
+    for (int t = 0; t < header->num_teams; t++) {
+        add_team_name(server, teams[t].name);
+        server->teams[t].max_clients = teams[t].max_clients;
+    }
+}
+
+static int restore_chunks(map_t *map, const checkpointchunk_t *records,
+    uint32_t count)
+{
+    mapchunk_t *chunk;
+
+    if (reserve_live_chunks(map, count) < 0)
+        return -1;
+    for (uint32_t i = 0; i < count; i++) {
+        if (records[i].chunk_id >= map->chunk_count ||
+            map->chunks[records[i].chunk_id])
+            return -1;
+        chunk = aligned_alloc(MAP_ALIGNMENT, CHUNK_ALLOC_SIZE);
+        if (!chunk)
+            return -1;
+        memset(chunk, 0, sizeof(mapchunk_t));
+        memcpy(chunk->resources, records[i].resources,
+            sizeof(chunk->resources));
+        adopt_chunk(map, records[i].chunk_id, chunk);
+    }
+    return 0;
+}
+
+static int restore_eggs(server_t *server, const checkpointegg_t *records,
+    int count)
+{
+    const checkpointegg_t *egg;
+
+    for (int i = count - 1; i >= 0; i--) {
+        egg = &records[i];
+        if (egg->team_id < 0 || egg->team_id >= server->num_teams ||
+            egg->x < 0 || egg->x >= server->width ||
+            egg->y < 0 || egg->y >= server->height)
+            return -1;
+        server->next_egg_id = egg->id;
+        if (!lay_egg(server, egg->team_id, egg->parent_id,
+            (position_t){egg->x, egg->y}))
+            return -1;
+    }
+    return 0;
+}
+
+static int restore_world(server_t *server, const checkpointheader_t *header)
+{
+    const checkpointchunk_t *chunks = (const checkpointchunk_t *)
+        ((const checkpointteam_t *)(header + 1) + header->num_teams);
+    const checkpointegg_t *eggs = (const checkpointegg_t *)
+        (chunks + header->chunk_count);
+    const checkpointplayer_t *players = (const checkpointplayer_t *)
+        (eggs + header->egg_count);
+
+    apply_header(server, header);
+    print_server_info(server);
+    if (init_map(server) < 0 ||
+        restore_chunks(server->map, chunks, header->chunk_count) < 0)
+        return -1;
+    memcpy(server->map->totals, header->totals, sizeof(header->totals));
+    if (restore_eggs(server, eggs, header->egg_count) < 0)
+        return -1;
+    server->next_egg_id = header->next_egg_id;
+    tick_resume(server, header->tick);
+    server->next_respawn_tick = header->next_respawn_tick;
+    return restore_players(server, players, header->player_count);
+}
+
+int restore_checkpoint(server_t *server, const char *path)
+{
+    size_t size = 0;
+    const char *data = map_file(path, &size);
+    int status = -1;
+
+    if (!data) {
+        fprintf(stderr, "Cannot read checkpoint %s\n", path);
+        return -1;
+    }
+    if (size >= sizeof(checkpointheader_t) &&
+        valid_header((const checkpointheader_t *)data, size))
+        status = restore_world(server, (const checkpointheader_t *)data);
+    unmap_file(data, size);
+    if (status < 0)
+        fprintf(stderr, "Invalid checkpoint %s\n", path);
+    return status;
+}
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** restore_players.c
+*/
+
+#include "checkpoint/checkpoint.h"
+#include "map/resource.h"
+#include "team.h"
+
+static bool valid_queue(const actionqueue_t *queue)
+{
+    const action_t *action;
+
+    if (queue->head < 0 || queue->head >= ACTION_QUEUE_SIZE ||
+        queue->count < 0 || queue->count > ACTION_QUEUE_SIZE ||
+        queue->arena_tail > ACTION_ARENA_SIZE)
+        return false;
+    for (int i = 0; i < queue->count; i++) {
+        action = &queue->slots[(queue->head + i) & ACTION_QUEUE_MASK];
+        if (action->opcode < 0 || action->opcode >= CMD_COUNT ||
+            action->offset >= ACTION_ARENA_SIZE ||
+            action->length >= ACTION_ARENA_SIZE - action->offset ||
+            queue->arena[action->offset + action->length] != '\0')
+            return false;
+    }
+    return true;
+}
+
+static bool valid_player(server_t *server, const checkpointplayer_t *record,
+    int count)
+{
+    return record->team_id >= 0 && record->team_id < server->num_teams &&
+        record->x >= 0 && record->x < server->width &&
+        record->y >= 0 && record->y < server->height &&
+        record->orientation >= 0 && record->orientation < 4 &&
+        record->level >= 1 && record->level <= LEVEL_MAX &&
+        record->ritual >= -1 && record->ritual < count &&
+        valid_queue(&record->actions);
+}
+
+static int restore_player(server_t *server, player_t *player,
+    const checkpointplayer_t *record)
+{
+    team_t *team = &server->teams[record->team_id];
+
+    player->team_id = record->team_id;
+    strcpy(player->team_name, team->name);
+    player->orientation = record->orientation;
+    player->level = record->level;
+    memcpy(player->inventory, record->inventory, sizeof(record->inventory));
+    player->starve_tick = record->starve_tick;
+    player->actions = record->actions;
+    add_dormant_player(server, player);
+    team->current_clients++;
+    if (!place_player(server->map, player, record->x, record->y))
+        return -1;
+    if (player->level == LEVEL_MAX)
+        team->max_level_players++;
+    return 0;
+}
+
+static void restore_rituals(server_t *server,
+    const checkpointplayer_t *records, int count)
+{
+    player_t *leader;
+    player_t *player;
+    int ritual;
+
+    for (int i = 0; i < count; i++) {
+        ritual = records[i].ritual;
+        if (ritual < 0 || records[ritual].ritual != ritual)
+            continue;
+        leader = &server->players[server->live_players[ritual]];
+        player = &server->players[server->live_players[i]];
+        if (player == leader)
+            leader->ritual = leader;
+        else
+            join_incantation(leader, player);
+    }
+}
+
+int restore_players(server_t *server, const checkpointplayer_t *records,
+    int count)
+{
+    player_t *player;
+
+    for (int i = 0; i < count; i++) {
+        if (!valid_player(server, &records[i], count))
+            return -1;
+        player = player_alloc(server);
+        if (!player)
+            return -1;
+        player->inventory = malloc(sizeof(int) * RESOURCE_COUNT);
+        if (!player->inventory ||
+            restore_player(server, player, &records[i]) < 0)
+            return -1;
+    }
+    restore_rituals(server, records, count);
+    return 0;
+}
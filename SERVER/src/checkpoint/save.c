@@ -0,0 +1,185 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** save.c
+*/
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include "checkpoint/checkpoint.h"
+#include "time/tick.h"
+#include "egg.h"
+
+size_t get_checkpoint_size(const checkpointheader_t *header)
+{
+    return sizeof(checkpointheader_t)
+        + sizeof(checkpointteam_t) * (size_t)header->num_teams
+        + sizeof(checkpointchunk_t) * (size_t)header->chunk_count
+        + sizeof(checkpointegg_t) * (size_t)header->egg_count
+        + sizeof(checkpointplayer_t) * (size_t)header->player_count;
+}
+
+static void fill_layout(checkpointheader_t *header)
+{
+    memcpy(header->magic, CHECKPOINT_MAGIC, sizeof(header->magic));
+    header->version = CHECKPOINT_VERSION;
+    header->header_size = sizeof(checkpointheader_t);
+    header->team_size = sizeof(checkpointteam_t);
+    header->chunk_size = sizeof(checkpointchunk_t);
+    header->egg_size = sizeof(checkpointegg_t);
+    header->player_size = sizeof(checkpointplayer_t);
+    header->action_queue_size = ACTION_QUEUE_SIZE;
+    header->action_arena_size = ACTION_ARENA_SIZE;
+}
+
+static void fill_header(server_t *server, checkpointheader_t *header)
+{
+    memset(header, 0, sizeof(checkpointheader_t));
+    fill_layout(header);
+    header->width = server->width;
+    header->height = server->height;
+    header->freq = server->freq;
+    header->num_teams = server->num_teams;
+    header->next_egg_id = server->next_egg_id;
+    header->player_count = server->num_players;
+    for (int t = 0; t < server->num_teams; t++)
+        header->egg_count += server->teams[t].egg_count;
+    header->chunk_count = server->map->live_count;
+    header->seed = server->seed;
+    header->tick = tick_now(server);
+    header->next_respawn_tick = server->next_respawn_tick;
+    header->rng = server->rng;
+    memcpy(header->totals, server->map->totals, sizeof(header->totals));
+}
+
+static char *write_world(server_t *server, char *cursor)
+{
+    checkpointteam_t *team;
+    checkpointchunk_t *chunk;
+    size_t chunk_id;
+
+    for (int t = 0; t < server->num_teams; t++) {
+        team = (checkpointteam_t *)cursor;
+        memcpy(team->name, server->teams[t].name, MAX_TEAM_NAME);
+        team->max_clients = server->teams[t].max_clients;
+        cursor += sizeof(checkpointteam_t);
+    }
+    for (size_t i = 0; i < server->map->live_count; i++) {
+        chunk = (checkpointchunk_t *)cursor;
+        chunk_id = server->map->live_chunks[i];
+        chunk->chunk_id = chunk_id;
+        memcpy(chunk->resources, server->map->chunks[chunk_id]->resources,
+            sizeof(chunk->resources));
+        cursor += sizeof(checkpointchunk_t);
+    }
+    return cursor;
+}
+
+static char *write_eggs(server_t *server, char *cursor)
+{
+    checkpointegg_t *record;
+
+    for (int t = 0; t < server->num_teams; t++) {
+        for (egg_t *egg = server->teams[t].eggs; egg; egg = egg->team_next) {
+            record = (checkpointegg_t *)cursor;
+            record->id = egg->id;
+            record->parent_id = egg->parent_id;
+            record->team_id = egg->team_id;
+            record->x = egg->x;
+            record->y = egg->y;
+            cursor += sizeof(checkpointegg_t);
+        }
+    }
+    return cursor;
+}
+
+static void write_player_ticks(server_t *server, player_t *player,
+    checkpointplayer_t *record)
+{
+    action_t *action;
+
+    record->starve_tick = player->starve_tick;
+    record->actions = player->actions;
+    if (player->socket != -1)
+        return;
+    record->starve_tick += tick_now(server) - player->dormant_tick;
+    action = action_queue_front(&record->actions);
+    if (action)
+        action->end_tick += tick_now(server) - player->dormant_tick;
+}
+
+static void write_players(server_t *server, char *cursor)
+{
+    checkpointplayer_t *record;
+    player_t *player;
+
+    for (int i = 0; i < server->num_players; i++) {
+        player = &server->players[server->live_players[i]];
+        record = (checkpointplayer_t *)cursor;
+        record->x = player->x;
+        record->y = player->y;
+        record->orientation = player->orientation;
+        record->level = player->level;
+        record->team_id = player->team_id;
+        record->ritual = player->ritual ? player->ritual->live_index : -1;
+        memcpy(record->inventory, player->inventory,
+            sizeof(record->inventory));
+        write_player_ticks(server, player, record);
+        cursor += sizeof(checkpointplayer_t);
+    }
+}
+
+static char *map_output(const char *path, size_t size, int *fd)
+{
+    char *data;
+
+    *fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (*fd < 0)
+        return NULL;
+    if (posix_fallocate(*fd, 0, (off_t)size) != 0) {
+        close(*fd);
+        unlink(path);
+        return NULL;
+    }
+    data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, *fd, 0);
+    if (data != MAP_FAILED)
+        return data;
+    close(*fd);
+    unlink(path);
+    return NULL;
+}
+
+static int commit_output(int fd, const char *temp, const char *path)
+{
+    int status = fsync(fd);
+
+    if (close(fd) < 0 || status < 0 || rename(temp, path) < 0) {
+        unlink(temp);
+        return -1;
+    }
+    return 0;
+}
+
+int save_checkpoint(server_t *server, const char *path)
+{
+    checkpointheader_t header;
+    char temp[PATH_MAX];
+    size_t size;
+    char *data;
+    int fd;
+
+    fill_header(server, &header);
+    size = get_checkpoint_size(&header);
+    if (snprintf(temp, sizeof(temp), "%s.tmp", path) >= (int)sizeof(temp))
+        return -1;
+    data = map_output(temp, size, &fd);
+    if (!data)
+        return -1;
+    memcpy(data, &header, sizeof(header));
+    write_players(server,
+        write_eggs(server, write_world(server, data + sizeof(header))));
+    munmap(data, size);
+    return commit_output(fd, temp, path);
+}
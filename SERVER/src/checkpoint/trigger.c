@@ -0,0 +1,36 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** trigger.c
+*/
+
+#include <signal.h>
+#include "checkpoint/checkpoint.h"
+
+static volatile sig_atomic_t checkpoint_pending = 0;
+
+void request_checkpoint(int signum)
+{
+    (void)signum;
+    checkpoint_pending = 1;
+}
+
+int write_checkpoint(server_t *server)
+{
+    if (save_checkpoint(server, server->checkpoint_path) < 0) {
+        fprintf(stderr, "Cannot write checkpoint %s\n",
+            server->checkpoint_path);
+        return -1;
+    }
+    printf("Checkpoint written to %s\n", server->checkpoint_path);
+    return 0;
+}
+
+void process_checkpoint_request(server_t *server)
+{
+    if (!checkpoint_pending)
+        return;
+    checkpoint_pending = 0;
+    write_checkpoint(server);
+}
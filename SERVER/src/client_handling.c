@@ -12,20 +12,17 @@
 ** client_handling.c
 */
 
+#define _GNU_SOURCE
 #include "graphic.h"
 #include "server.h"
 #include "time/tick.h"
 #include "command/gui_commands.h"
 #include "map/resource.h"
 #include "player.h"
-
-static void add_client_to_fds(server_t *server, int new_socket)
-{
-    FD_SET(new_socket, &server->master_fds);
-    if (new_socket > server->max_fd) {
-        server->max_fd = new_socket;
-    }
-}
+#include "network/spectator.h"
+#include "egg.h"
+#include "journal/journal.h"
+#include <errno.h>
 
 static void handle_new_connection(server_t *server)
 {
@@ -34,40 +31,33 @@ static void handle_new_connection(server_t *server)
     socklen_t addr_len = sizeof(client_addr);
     char buffer[1024];
 
-    new_socket = accept(server->server_socket, (struct sockaddr*)&client_addr,
-            &addr_len);
+    new_socket = accept4(server->server_socket,
+        (struct sockaddr*)&client_addr, &addr_len, SOCK_NONBLOCK);
     if (new_socket < 0)
         return;
     printf("New connection from %s:%d\n", inet_ntoa(client_addr.sin_addr),
         ntohs(client_addr.sin_port));
+    if (!client_create(server, new_socket)) {
+        close(new_socket);
+        return;
+    }
     snprintf(buffer, 1024, "WELCOME\n");
-    send(new_socket, buffer, strlen(buffer), 0);
-    add_client_to_fds(server, new_socket);
+    client_send(server, new_socket, buffer, strlen(buffer));
 }
 
-static void handle_client_disconnect(server_t *server, int client_socket)
+static void handle_client_disconnect(server_t *server, client_t *client)
 {
-    int player_index = find_player_by_socket(server, client_socket);
+    int player_index = client->player;
 
     printf("Client disconnected\n");
-    close(client_socket);
-    FD_CLR(client_socket, &server->master_fds);
-    if (player_index != -1) {
-        remove_player(server, player_index);
-    }
-    if (client_socket == server->graphic_fd) {
+    if (client->type == CLIENT_GRAPHIC) {
         printf("Client GRAPHIC déconnecté\n");
-        server->graphic_fd = -1;
+        spectator_remove(server, client);
     }
-}
-
-static void clean_message_buffer(char *buffer, int bytes_received)
-{
-    for (int i = 0; i < bytes_received; i++) {
-        if (buffer[i] == '\n' || buffer[i] == '\r') {
-            buffer[i] = '\0';
-            break;
-        }
+    client_destroy(server, client);
+    if (player_index != -1) {
+        journal_event(server, JOURNAL_LEAVE, player_index);
+        remove_player(server, player_index);
     }
 }
 
@@ -75,55 +65,90 @@ void send_connection_info(server_t *server, int client_socket, int team_id)
 {
     char response[1024];
 
-    snprintf(response, 1024, "%d\n%d %d\n",
-            server->teams[team_id].max_clients - server->teams[team_id]
-            .current_clients, server->width, server->height);
-    send(client_socket, response, strlen(response), 0);
+    snprintf(response, 1024, "%d\n%d %d\n", server->teams[team_id].egg_count
+            + server->teams[team_id].dormant_count, server->width,
+            server->height);
+    client_send(server, client_socket, response, strlen(response));
 }
 
-static void handle_client_message(server_t *server, int client_socket)
+static void queue_player_command(server_t *server, player_t *player,
+    const char *command)
 {
-    char buffer[1024];
-    int bytes_received = recv(client_socket, buffer, 1024 - 1, 0);
-    int player_index = find_player_by_socket(server, client_socket);
+    if (player->actions.count >= MAX_PENDING_ACTIONS)
+        return;
+    add_action_to_queue(server, player, command);
+}
 
-    if (bytes_received <= 0) {
-        handle_client_disconnect(server, client_socket);
+static void dispatch_client_line(server_t *server, client_t *client,
+    char *line)
+{
+    if (client->type == CLIENT_GRAPHIC) {
+        process_gui_command(server, client->fd, line);
         return;
     }
-    buffer[bytes_received] = '\0';
-    clean_message_buffer(buffer, bytes_received);
-    if (client_socket == server->graphic_fd) {
-        process_gui_command(server, client_socket, buffer);
+    if (client->player == -1) {
+        verif_graphic_connexion(server, client->fd, line);
+    } else
+        queue_player_command(server, &server->players[client->player], line);
+}
+
+static void handle_client_message(server_t *server, client_t *client)
+{
+    char line[CLIENT_INPUT_SIZE + 1];
+    ssize_t received = client_read(client);
+
+    if (received == 0 || (received < 0 && errno != EAGAIN &&
+        errno != EWOULDBLOCK)) {
+        client_close(server, client);
         return;
     }
-    if (player_index == -1) {
-        verif_graphic_connexion(server, client_socket, buffer);
-    } else
-        add_action_to_queue(&server->players[player_index], buffer,
-                            server->freq);
+    while (!client->closing && client_next_line(client, line))
+        dispatch_client_line(server, client, line);
 }
 
-void check_new_connections(server_t *server, fd_set *read_fds)
+void handle_poll_event(server_t *server, struct epoll_event *event)
 {
-    if (FD_ISSET(server->server_socket, read_fds)) {
+    client_t *client = event->data.ptr;
+
+    if (client == NULL) {
         handle_new_connection(server);
+        return;
     }
+    if (event->events & EPOLLOUT)
+        client_mark_dirty(server, client);
+    if (!client->closing && event->events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        handle_client_message(server, client);
 }
 
-void check_client_messages(server_t *server, fd_set *read_fds)
+void flush_clients(server_t *server)
 {
-    for (int i = 0; i <= server->max_fd; i++) {
-        if (i != server->server_socket && FD_ISSET(i, read_fds)) {
-            handle_client_message(server, i);
-        }
+    client_t *client;
+
+    spectator_publish(server);
+    while (server->dirty_clients) {
+        client = server->dirty_clients;
+        server->dirty_clients = client->next_dirty;
+        client->in_dirty = false;
+        if (client_flush(server, client) < 0 || client->closing)
+            handle_client_disconnect(server, client);
+        spectator_publish(server);
     }
 }
 
 void cleanup_server(server_t *server)
 {
-    for (int i = 0; i < server->num_players; i++) {
-        close(server->players[i].socket);
-    }
+    spectator_destroy_all(server);
+    client_destroy_all(server);
+    heap_destroy(&server->action_timers);
+    heap_destroy(&server->starvation);
+    for (int i = 0; i < server->num_players; i++)
+        free(server->players[server->live_players[i]].inventory);
+    free(server->players);
+    free(server->live_players);
+    free_eggs(server);
+    free_map(server->map);
+    close_journal(server);
+    writer_free(&server->scratch);
+    close(server->epoll_fd);
     close(server->server_socket);
 }
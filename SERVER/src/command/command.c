@@ -10,134 +10,74 @@
 #include "server.h"
 #include "player.h"
 
-int get_command_duration(const char *command)
+static void handle_connect_nbr_command(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
-    size_t len = 0;
-    static commandduration_t durations[] = {{"Forward", 7}, {"Right", 7},
-        {"Left", 7}, {"Look", 7}, {"Inventory", 1},
-            {"Take", 7}, {"Set", 7}, {"Eject", 7},
-                {"Broadcast", 7}, {"Incantation", 300},
-                    {"Fork", 42}, {"Connect_nbr", 0}, {NULL, 0} };
-
-    for (int i = 0; durations[i].name != NULL; i++) {
-        len = strlen(durations[i].name);
-        if (strncmp(command, durations[i].name, len) == 0 &&
-            (command[len] == '\0' || command[len] == ' '))
-            return durations[i].duration;
-    }
-    return -1;
+    (void)arg;
+    snprintf(response, BUFFER_SIZE, "%d\n",
+        server->teams[player->team_id].egg_count +
+        server->teams[player->team_id].dormant_count);
 }
 
-static void handle_take_set_commands(player_t *player, server_t *server,
-    const char *command, char *response)
+static void handle_unknown_command(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
-    if (strncmp(command, "Take ", 5) == 0) {
-        handle_take_command(player, server, command + 5, response);
-        return;
-    }
-    if (strncmp(command, "Set ", 4) == 0) {
-        handle_set_command(player, server, command + 4, response);
-        return;
-    }
+    (void)player;
+    (void)server;
+    (void)arg;
     strcpy(response, "ko\n");
 }
 
-void handle_broadcast_command(player_t *player, server_t *server,
-    const char *command, char *response)
-{
-    const char *text;
-    int player_id;
-
-    if (strncmp(command, "Broadcast ", 10) != 0) {
-        strcpy(response, "ko\n");
-        return;
-    }
-    text = command + 10;
-    if (strlen(text) == 0) {
-        strcpy(response, "ko\n");
-        return;
-    }
-    player_id = player - server->players;
-    handle_player_broadcast(server, player_id, text);
-    strcpy(response, "ok\n");
-}
+static const commanddef_t COMMANDS[CMD_COUNT] = {
+    [CMD_FORWARD] = {"Forward", 7, 7, false, handle_forward_command},
+    [CMD_RIGHT] = {"Right", 5, 7, false, handle_right_command},
+    [CMD_LEFT] = {"Left", 4, 7, false, handle_left_command},
+    [CMD_LOOK] = {"Look", 4, 7, false, handle_look_command},
+    [CMD_INVENTORY] = {"Inventory", 9, 1, false, handle_inventory_command},
+    [CMD_BROADCAST] = {"Broadcast", 9, 7, true, handle_broadcast_command},
+    [CMD_CONNECT_NBR] = {"Connect_nbr", 11, 0, false,
+        handle_connect_nbr_command},
+    [CMD_FORK] = {"Fork", 4, 42, false, handle_fork_command},
+    [CMD_EJECT] = {"Eject", 5, 7, false, handle_eject_command},
+    [CMD_TAKE] = {"Take", 4, 7, true, handle_take_command},
+    [CMD_SET] = {"Set", 3, 7, true, handle_set_command},
+    [CMD_INCANTATION] = {"Incantation", 11, 0, false, prepare_incantation},
+    [CMD_ELEVATION] = {NULL, 0, 300, false, finish_incantation},
+    [CMD_UNKNOWN] = {NULL, 0, 0, false, handle_unknown_command},
+};
 
-static void handle_special_commands(player_t *player, server_t *server,
-    const char *command, char *response)
+opcode_t parse_command(const char *line, const char **arg)
 {
-    if (strcmp(command, "Fork") == 0) {
-        handle_fork_command(player, server, response);
-        return;
-    }
-    if (strcmp(command, "Eject") == 0) {
-        handle_eject_command(player, server, response);
-        return;
-    }
-    if (strcmp(command, "Incantation") == 0) {
-        prepare_incantation(player, server, response);
-        return;
-    }
-    if (strncmp(command, "Broadcast ", 10) == 0) {
-        handle_broadcast_command(player, server, command, response);
-        return;
-    }
-    strcpy(response, "ko\n");
-}
+    const char *space = strchr(line, ' ');
+    size_t len = space ? (size_t)(space - line) : strlen(line);
 
-static void handle_action_command(player_t *player, server_t *server,
-    const char *command, char *response)
-{
-    if (strncmp(command, "Take ", 5) == 0 || strncmp(command, "Set ", 4) == 0){
-        handle_take_set_commands(player, server, command, response);
-        return;
-    }
-    handle_special_commands(player, server, command, response);
+    *arg = space ? space + 1 : "";
+    for (int op = 0; op < CMD_UNKNOWN; op++) {
+        if (COMMANDS[op].name && COMMANDS[op].name_len == len &&
+            COMMANDS[op].has_arg == (space != NULL) &&
+            memcmp(COMMANDS[op].name, line, len) == 0)
+            return op;
+    }
+    *arg = "";
+    return CMD_UNKNOWN;
 }
 
-static void handle_info_command(player_t *player, server_t *server, const char
-    *command, char *response)
+int get_command_duration(opcode_t opcode)
 {
-    if (strcmp(command, "Look") == 0) {
-        handle_look_command(player, server, response);
-        return;
-    }
-    if (strcmp(command, "Inventory") == 0) {
-        handle_inventory_command(player, response);
-        return;
-    }
-    if (strcmp(command, "Connect_nbr") == 0) {
-        snprintf(response, 1024, "%d\n",
-        server->teams[player->team_id].max_clients -
-            server->teams[player->team_id].current_clients);
-    }
+    return COMMANDS[opcode].duration;
 }
 
-void handle_movement_command(player_t *player, server_t *server,
-    const char *command, char *response)
+const char *get_command_name(opcode_t opcode)
 {
-    if (strcmp(command, "Forward") == 0) {
-        move_player_forward(player, server);
-        strcpy(response, "ok\n");
-    }
-    if (strcmp(command, "Right") == 0) {
-        player->orientation = (player->orientation + 1) % 4;
-        strcpy(response, "ok\n");
-    }
-    if (strcmp(command, "Left") == 0) {
-        player->orientation = (player->orientation + 3) % 4;
-        strcpy(response, "ok\n");
-    }
+    return COMMANDS[opcode].name ? COMMANDS[opcode].name : "(internal)";
 }
 
 void process_player_command(player_t *player, server_t *server,
-    const char *command)
+    opcode_t opcode, const char *arg)
 {
-    char response[1024] = "";
+    char response[BUFFER_SIZE] = "";
 
-    handle_movement_command(player, server, command, response);
-    if (response[0] == '\0')
-        handle_info_command(player, server, command, response);
-    if (response[0] == '\0')
-        handle_action_command(player, server, command, response);
-    send(player->socket, response, strlen(response), 0);
+    COMMANDS[opcode].handler(player, server, arg, response);
+    if (response[0] != '\0')
+        client_send(server, player->socket, response, strlen(response));
 }
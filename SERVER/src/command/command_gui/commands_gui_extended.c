@@ -8,25 +8,28 @@
 #include "server.h"
 #include "command/gui_commands.h"
 #include "map/resource.h"
+#include "time/tick.h"
 
 void handle_gui_sst(server_t *server, int client_socket, int new_freq)
 {
     char buffer[256];
 
     if (new_freq <= 0) {
-        send(client_socket, "sbp\n", 4, 0);
+        client_send(server, client_socket, "sbp\n", 4);
         return;
     }
-    server->freq = new_freq;
+    tick_set_freq(server, new_freq);
     snprintf(buffer, sizeof(buffer), "sst %d\n", server->freq);
-    send(client_socket, buffer, strlen(buffer), 0);
+    client_send(server, client_socket, buffer, strlen(buffer));
 }
 
 void send_gui_pnw(server_t *server, int player_id)
 {
     char buffer[256];
-    player_t *player = &server->players[player_id];
+    player_t *player = get_player_by_id(server, player_id);
 
+    if (!player)
+        return;
     snprintf(buffer, sizeof(buffer), "pnw #%d %d %d %d %d %s\n",
         player_id, player->x, player->y, player->orientation + 1,
             player->level, server->teams[player->team_id].name);
@@ -43,23 +46,24 @@ void send_gui_pex(server_t *server, int player_id)
 
 void send_gui_pbc(server_t *server, int player_id, const char *message)
 {
-    char buffer[512];
+    char prefix[32];
 
-    snprintf(buffer, sizeof(buffer), "pbc #%d %s\n", player_id, message);
-    broadcast_to_gui_clients(server, buffer);
+    snprintf(prefix, sizeof(prefix), "pbc #%d ", player_id);
+    broadcast_to_gui_clients(server, prefix);
+    broadcast_to_gui_clients(server, message);
+    broadcast_to_gui_clients(server, "\n");
 }
 
-static void build_pic_buffer(char *buffer, player_t *player,
-    list_t *players_on_tile)
+static void build_pic_buffer(char *buffer, player_t *leader)
 {
     char temp[32];
-    list_t *current = players_on_tile;
 
-    snprintf(buffer, 512, "pic %d %d %d", player->x, player->y, player->level);
-    while (current != NULL) {
-        snprintf(temp, sizeof(temp), " #%d", current->player->team_id);
+    snprintf(buffer, 512, "pic %d %d %d", leader->x, leader->y, leader->level);
+    for (player_t *p = leader; p != NULL; p = p->ritual_next) {
+        snprintf(temp, sizeof(temp), " #%d", get_player_id(p));
+        if (strlen(buffer) + strlen(temp) >= 511)
+            break;
         strcat(buffer, temp);
-        current = current->next;
     }
     strcat(buffer, "\n");
 }
@@ -67,8 +71,7 @@ static void build_pic_buffer(char *buffer, player_t *player,
 void send_gui_pic(server_t *server, player_t *player)
 {
     char buffer[512];
-    tile_t *tile = &server->map->tiles[player->y][player->x];
 
-    build_pic_buffer(buffer, player, tile->players_on_tile);
+    build_pic_buffer(buffer, player);
     broadcast_to_gui_clients(server, buffer);
 }
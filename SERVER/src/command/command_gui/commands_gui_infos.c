@@ -8,40 +8,34 @@
 #include "server.h"
 #include "command/gui_commands.h"
 #include "map/resource.h"
-
-static int validate_player_id(server_t *server, int player_id)
-{
-    return (player_id >= 0 && player_id < server->num_players);
-}
+#include "time/life.h"
 
 void handle_gui_ppo(server_t *server, int client_socket, int player_id)
 {
     char buffer[256];
-    player_t *player;
+    player_t *player = get_player_by_id(server, player_id);
 
-    if (!validate_player_id(server, player_id)) {
-        send(client_socket, "sbp\n", 4, 0);
+    if (!player) {
+        client_send(server, client_socket, "sbp\n", 4);
         return;
     }
-    player = &server->players[player_id];
     snprintf(buffer, sizeof(buffer), "ppo #%d %d %d %d\n",
         player_id, player->x, player->y, player->orientation + 1);
-    send(client_socket, buffer, strlen(buffer), 0);
+    client_send(server, client_socket, buffer, strlen(buffer));
 }
 
 void handle_gui_plv(server_t *server, int client_socket, int player_id)
 {
     char buffer[256];
-    player_t *player;
+    player_t *player = get_player_by_id(server, player_id);
 
-    if (!validate_player_id(server, player_id)) {
-        send(client_socket, "sbp\n", 4, 0);
+    if (!player) {
+        client_send(server, client_socket, "sbp\n", 4);
         return;
     }
-    player = &server->players[player_id];
     snprintf(buffer, sizeof(buffer), "plv #%d %d\n",
         player_id, player->level);
-    send(client_socket, buffer, strlen(buffer), 0);
+    client_send(server, client_socket, buffer, strlen(buffer));
 }
 
 static void format_pin_response(char *buffer, int player_id, player_t *player)
@@ -57,13 +51,13 @@ static void format_pin_response(char *buffer, int player_id, player_t *player)
 void handle_gui_pin(server_t *server, int client_socket, int player_id)
 {
     char buffer[256];
-    player_t *player;
+    player_t *player = get_player_by_id(server, player_id);
 
-    if (!validate_player_id(server, player_id)) {
-        send(client_socket, "sbp\n", 4, 0);
+    if (!player) {
+        client_send(server, client_socket, "sbp\n", 4);
         return;
     }
-    player = &server->players[player_id];
+    get_player_food(server, player);
     format_pin_response(buffer, player_id, player);
-    send(client_socket, buffer, strlen(buffer), 0);
+    client_send(server, client_socket, buffer, strlen(buffer));
 }
@@ -8,6 +8,8 @@
 #include "server.h"
 #include "command/gui_commands.h"
 #include "map/resource.h"
+#include "network/snapshot.h"
+#include "utils/format.h"
 
 void handle_gui_msz(server_t *server, int client_socket)
 {
@@ -15,32 +17,30 @@ void handle_gui_msz(server_t *server, int client_socket)
 
     snprintf(buffer, sizeof(buffer), "msz %d %d\n",
         server->width, server->height);
-    send(client_socket, buffer, strlen(buffer), 0);
+    client_send(server, client_socket, buffer, strlen(buffer));
 }
 
 void handle_gui_bct(server_t *server, int client_socket, int x, int y)
 {
-    char buffer[256];
-    tile_t *tile;
+    char buffer[BCT_LINE_MAX];
+    const mapchunk_t *chunk = NULL;
+    size_t len;
 
-    if (x < 0 || x >= server->width || y < 0 || y >= server->height) {
-        send(client_socket, "sbp\n", 4, 0);
+    if (x >= 0 && x < server->width && y >= 0 && y < server->height)
+        chunk = peek_chunk(server->map,
+            get_tile_at(server->map, x, y) >> (2 * CHUNK_SHIFT));
+    if (!chunk) {
+        client_send(server, client_socket, "sbp\n", 4);
         return;
     }
-    tile = &server->map->tiles[y][x];
-    snprintf(buffer, sizeof(buffer), "bct %d %d %d %d %d %d %d %d %d\n",
-        x, y, tile->resources[FOOD], tile->resources[LINEMATE],
-            tile->resources[DERAUMERE], tile->resources[SIBUR],
-                tile->resources[MENDIANE], tile->resources[PHIRAS],
-                    tile->resources[THYSTAME]);
-    send(client_socket, buffer, strlen(buffer), 0);
+    len = format_bct(buffer, chunk, x, y);
+    client_send(server, client_socket, buffer, len);
 }
 
 void handle_gui_mct(server_t *server, int client_socket)
 {
-    for (int y = 0; y < server->height; y++) {
-        for (int x = 0; x < server->width; x++) {
-            handle_gui_bct(server, client_socket, x, y);
-        }
-    }
+    client_t *client = client_get(server, client_socket);
+
+    if (client)
+        snapshot_start(server, client);
 }
@@ -28,12 +28,11 @@ void send_gui_pdi(server_t *server, int player_id)
 void send_gui_ppo(server_t *server, int player_id)
 {
     char buffer[256];
-    player_t *player;
+    player_t *player = get_player_by_id(server, player_id);
 
-    if (player_id < 0 || player_id >= server->num_players) {
+    if (!player) {
         return;
     }
-    player = &server->players[player_id];
     snprintf(buffer, sizeof(buffer), "ppo #%d %d %d %d\n",
         player_id, player->x, player->y, player->orientation + 1);
     broadcast_to_gui_clients(server, buffer);
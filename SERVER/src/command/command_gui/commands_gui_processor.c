@@ -7,6 +7,7 @@
 
 #include "server.h"
 #include "command/gui_commands.h"
+#include "journal/journal.h"
 
 static void process_basic_commands(server_t *server, int client_socket,
     char *cmd)
@@ -23,7 +24,7 @@ static void process_basic_commands(server_t *server, int client_socket,
         handle_gui_tna(server, client_socket);
         return;
     }
-    send(client_socket, "suc\n", 4, 0);
+    client_send(server, client_socket, "suc\n", 4);
 }
 
 static void process_coordinate_commands(server_t *server, int client_socket,
@@ -36,11 +37,11 @@ static void process_coordinate_commands(server_t *server, int client_socket,
         if (arg1 && arg2) {
             handle_gui_bct(server, client_socket, atoi(arg1), atoi(arg2));
         } else {
-            send(client_socket, "sbp\n", 4, 0);
+            client_send(server, client_socket, "sbp\n", 4);
         }
         return;
     }
-    send(client_socket, "suc\n", 4, 0);
+    client_send(server, client_socket, "suc\n", 4);
 }
 
 static void process_player_commands(server_t *server, int client_socket,
@@ -49,7 +50,7 @@ static void process_player_commands(server_t *server, int client_socket,
     char *arg1 = strtok(NULL, " ");
 
     if (!arg1 || arg1[0] != '#') {
-        send(client_socket, "sbp\n", 4, 0);
+        client_send(server, client_socket, "sbp\n", 4);
         return;
     }
     if (strcmp(cmd, "ppo") == 0) {
@@ -64,7 +65,7 @@ static void process_player_commands(server_t *server, int client_socket,
         handle_gui_pin(server, client_socket, atoi(arg1 + 1));
         return;
     }
-    send(client_socket, "suc\n", 4, 0);
+    client_send(server, client_socket, "suc\n", 4);
 }
 
 static void process_server_commands(server_t *server, int client_socket,
@@ -76,16 +77,20 @@ static void process_server_commands(server_t *server, int client_socket,
         handle_gui_sgt(server, client_socket);
         return;
     }
+    if (strcmp(cmd, "ckp") == 0) {
+        handle_gui_ckp(server, client_socket, strtok(NULL, " "));
+        return;
+    }
     if (strcmp(cmd, "sst") == 0) {
         arg1 = strtok(NULL, " ");
         if (arg1) {
             handle_gui_sst(server, client_socket, atoi(arg1));
         } else {
-            send(client_socket, "sbp\n", 4, 0);
+            client_send(server, client_socket, "sbp\n", 4);
         }
         return;
     }
-    send(client_socket, "suc\n", 4, 0);
+    client_send(server, client_socket, "suc\n", 4);
 }
 
 static int is_basic_command(char *cmd)
@@ -121,12 +126,20 @@ static void route_command(server_t *server, int client_socket, char *cmd)
     }
 }
 
+static bool is_journaled(const char *command)
+{
+    return strcspn(command, " \n") != 3 || strncmp(command, "ckp", 3) != 0;
+}
+
 void process_gui_command(server_t *server, int client_socket, char *command)
 {
-    char *cmd = strtok(command, " \n");
+    char *cmd;
 
+    if (is_journaled(command))
+        journal_text(server, JOURNAL_GUI, -1, command);
+    cmd = strtok(command, " \n");
     if (!cmd) {
-        send(client_socket, "suc\n", 4, 0);
+        client_send(server, client_socket, "suc\n", 4);
         return;
     }
     route_command(server, client_socket, cmd);
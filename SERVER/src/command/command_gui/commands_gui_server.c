@@ -5,13 +5,32 @@
 ** commands_gui_server
 */
 
+#include <limits.h>
 #include "server.h"
 #include "command/gui_commands.h"
+#include "checkpoint/checkpoint.h"
 
 void handle_gui_sgt(server_t *server, int client_socket)
 {
     char buffer[256];
 
     snprintf(buffer, sizeof(buffer), "sgt %d\n", server->freq);
-    send(client_socket, buffer, strlen(buffer), 0);
+    client_send(server, client_socket, buffer, strlen(buffer));
+}
+
+void handle_gui_ckp(server_t *server, int client_socket, const char *token)
+{
+    char buffer[PATH_MAX + 8];
+
+    if (!server->admin_token) {
+        client_send(server, client_socket, "suc\n", 4);
+        return;
+    }
+    if (!token || strcmp(token, server->admin_token) != 0 ||
+        write_checkpoint(server) < 0) {
+        client_send(server, client_socket, "sbp\n", 4);
+        return;
+    }
+    snprintf(buffer, sizeof(buffer), "ckp %s\n", server->checkpoint_path);
+    client_send(server, client_socket, buffer, strlen(buffer));
 }
@@ -15,6 +15,6 @@ void handle_gui_tna(server_t *server, int client_socket)
     for (int i = 0; i < server->num_teams; i++) {
         snprintf(buffer, sizeof(buffer), "tna %s\n",
             server->teams[i].name);
-        send(client_socket, buffer, strlen(buffer), 0);
+        client_send(server, client_socket, buffer, strlen(buffer));
     }
 }
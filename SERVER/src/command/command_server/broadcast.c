@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** broadcast.c
+*/
+
+#include "server.h"
+#include "player.h"
+#include "command/gui_commands.h"
+
+static const int FORWARD[4][2] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+static const int RIGHT[4][2] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+static const int SOUND_DIRECTION[3][2][2] = {
+    {{1, 1}, {5, 5}},
+    {{7, 3}, {7, 3}},
+    {{8, 2}, {6, 4}}
+};
+
+static int get_wrapped_distance(int from, int to, int size)
+{
+    int delta = to - from;
+
+    if (2 * delta > size)
+        delta -= size;
+    else if (2 * delta < -size)
+        delta += size;
+    return delta;
+}
+
+int calculate_sound_direction(server_t *server, player_t *sender,
+    player_t *receiver)
+{
+    int dx = get_wrapped_distance(receiver->x, sender->x, server->width);
+    int dy = get_wrapped_distance(receiver->y, sender->y, server->height);
+    int o = receiver->orientation;
+    int front = dx * FORWARD[o][0] + dy * FORWARD[o][1];
+    int right = dx * RIGHT[o][0] + dy * RIGHT[o][1];
+    int sector = 2;
+
+    if (dx == 0 && dy == 0)
+        return 0;
+    if (408 * abs(right) <= 169 * abs(front))
+        sector = 0;
+    else if (408 * abs(front) <= 169 * abs(right))
+        sector = 1;
+    return SOUND_DIRECTION[sector][front < 0][right < 0];
+}
+
+static sharedbuf_t *build_message(int direction, const char *text,
+    size_t text_len)
+{
+    char prefix[16];
+    int len = snprintf(prefix, sizeof(prefix), "message %d, ", direction);
+    sharedbuf_t *message = sharedbuf_create(len + text_len + 1);
+
+    if (!message)
+        return NULL;
+    sharedbuf_append(&message, prefix, len);
+    sharedbuf_append(&message, text, text_len);
+    sharedbuf_append(&message, "\n", 1);
+    return message;
+}
+
+static void send_message(server_t *server, broadcast_t *broadcast,
+    player_t *receiver)
+{
+    client_t *client = client_get(server, receiver->socket);
+    int direction;
+
+    if (!client)
+        return;
+    direction = calculate_sound_direction(server, broadcast->sender,
+        receiver);
+    if (!broadcast->messages[direction])
+        broadcast->messages[direction] = build_message(direction,
+            broadcast->text, broadcast->text_len);
+    if (broadcast->messages[direction])
+        client_send_shared(server, client, broadcast->messages[direction]);
+}
+
+void handle_player_broadcast(server_t *server, player_t *sender,
+    const char *text)
+{
+    broadcast_t broadcast = {sender, text, strlen(text), {NULL}};
+    player_t *receiver;
+
+    for (int i = 0; i < server->num_players; i++) {
+        receiver = &server->players[server->live_players[i]];
+        if (receiver != sender && receiver->team_id != -1 &&
+            receiver->socket > 0)
+            send_message(server, &broadcast, receiver);
+    }
+    for (int d = 0; d < BROADCAST_DIRECTIONS; d++)
+        sharedbuf_release(broadcast.messages[d]);
+    send_gui_pbc(server, get_player_id(sender), text);
+}
+
+void handle_broadcast_command(player_t *player, server_t *server,
+    const char *text, char *response)
+{
+    if (strlen(text) == 0) {
+        strcpy(response, "ko\n");
+        return;
+    }
+    handle_player_broadcast(server, player, text);
+    strcpy(response, "ok\n");
+}
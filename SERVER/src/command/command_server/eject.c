@@ -9,45 +9,47 @@
 #include "server.h"
 #include "player.h"
 #include "command/gui_commands.h"
+#include "egg.h"
 
-void move_player_direction(player_t *player, server_t *server, int dir)
+bool move_player_direction(player_t *player, server_t *server, int dir)
 {
-    switch (dir) {
-        case 0:
-            player->y = (player->y - 1 + server->height) % server->height;
-            break;
-        case 1:
-            player->x = (player->x + 1) % server->width;
-            break;
-        case 2:
-            player->y = (player->y + 1) % server->height;
-            break;
-        case 3:
-            player->x = (player->x - 1 + server->width) % server->width;
-            break;
-    }
+    static const int DX[4] = {0, 1, 0, -1};
+    static const int DY[4] = {-1, 0, 1, 0};
+
+    return place_player(server->map, player, player->x + DX[dir],
+        player->y + DY[dir]);
 }
 
-void handle_eject_command(player_t *player, server_t *server, char *response)
+static bool eject_player(server_t *server, player_t *target, int dir)
 {
-    tile_t *tile = &server->map->tiles[player->y][player->x];
-    list_t *list = tile->players_on_tile;
-    int player_id = player - server->players;
-    int ejected = 0;
-    int reverse_dir;
     char eject_msg[64];
+    int reverse_dir = (dir + 2) % 4 + 1;
+
+    if (!move_player_direction(target, server, dir))
+        return false;
+    snprintf(eject_msg, sizeof(eject_msg), "eject: %d\n", reverse_dir);
+    client_send(server, target->socket, eject_msg, strlen(eject_msg));
+    send_gui_ppo(server, get_player_id(target));
+    return true;
+}
+
+void handle_eject_command(player_t *player, server_t *server,
+    const char *arg, char *response)
+{
+    player_t *target = get_tile_players(server->map, player->tile);
+    player_t *next;
+    int ejected = 0;
 
-    while (list != NULL) {
-        if (list->player != player) {
-            move_player_direction(list->player, server, player->orientation);
-            reverse_dir = (player->orientation + 2) % 4 + 1;
-            snprintf(eject_msg, sizeof(eject_msg), "eject: %d\n", reverse_dir);
-            send(list->player->socket, eject_msg, strlen(eject_msg), 0);
+    (void)arg;
+    for (; target != NULL; target = next) {
+        next = target->tile_next;
+        if (target != player &&
+            eject_player(server, target, player->orientation))
             ejected = 1;
-        }
-        list = list->next;
     }
+    if (destroy_tile_eggs(server, player->tile) > 0)
+        ejected = 1;
     strcpy(response, ejected ? "ok\n" : "ko\n");
     if (ejected)
-        send_gui_pex(server, player_id);
+        send_gui_pex(server, get_player_id(player));
 }
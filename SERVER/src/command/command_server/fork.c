@@ -8,18 +8,22 @@
 #include "server.h"
 #include "player.h"
 #include "command/gui_commands.h"
+#include "egg.h"
 
-void handle_fork_command(player_t *player, server_t *server, char *response)
+void handle_fork_command(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
     position_t pos = {player->x, player->y};
-    int player_id = 0;
-    int egg_id = 0;
+    int player_id = get_player_id(player);
+    egg_t *egg;
 
-    player_id = player - server->players;
-    egg_id = server->next_egg_id;
-    server->next_egg_id++;
+    (void)arg;
+    egg = lay_egg(server, player->team_id, player_id, pos);
+    if (!egg) {
+        strcpy(response, "ko\n");
+        return;
+    }
     strcpy(response, "ok\n");
-    server->teams[player->team_id].max_clients++;
     send_gui_pfk(server, player_id);
-    send_gui_enw(server, egg_id, player_id, pos);
+    send_gui_enw(server, egg->id, player_id, pos);
 }
@@ -10,34 +10,35 @@
 #include "command/gui_commands.h"
 #include "map/resource.h"
 
-
-static void new_pos(server_t *server, player_t *player)
+bool move_player_forward(player_t *player, server_t *server)
 {
-    tile_t *tile = get_tile(server->map, player->x, player->y);
+    if (!move_player_direction(player, server, player->orientation))
+        return false;
+    send_gui_ppo(server, get_player_id(player));
+    return true;
+}
 
-    add_player_to_tile(tile, player);
+void handle_forward_command(player_t *player, server_t *server,
+    const char *arg, char *response)
+{
+    (void)arg;
+    strcpy(response, move_player_forward(player, server) ? "ok\n" : "ko\n");
 }
 
-void move_player_forward(player_t *player, server_t *server)
+void handle_right_command(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
-    int player_id = player - server->players;
-    tile_t *tile = get_tile(server->map, player->x, player->y);
+    (void)server;
+    (void)arg;
+    player->orientation = (player->orientation + 1) % 4;
+    strcpy(response, "ok\n");
+}
 
-    remove_player_from_tile(tile, player);
-    switch (player->orientation) {
-        case 0:
-            player->y = (player->y - 1 + server->height) % server->height;
-            break;
-        case 1:
-            player->x = (player->x + 1) % server->width;
-            break;
-        case 2:
-            player->y = (player->y + 1) % server->height;
-            break;
-        case 3:
-            player->x = (player->x - 1 + server->width) % server->width;
-            break;
-    }
-    new_pos(server, player);
-    send_gui_ppo(server, player_id);
+void handle_left_command(player_t *player, server_t *server,
+    const char *arg, char *response)
+{
+    (void)server;
+    (void)arg;
+    player->orientation = (player->orientation + 3) % 4;
+    strcpy(response, "ok\n");
 }
@@ -10,113 +10,127 @@
 #include "map/resource.h"
 #include "command/gui_commands.h"
 
+static const elevation_t ELEVATION[LEVEL_MAX - 1] = {
+    {1, {0, 1, 0, 0, 0, 0, 0}},
+    {2, {0, 1, 1, 1, 0, 0, 0}},
+    {2, {0, 2, 0, 1, 0, 2, 0}},
+    {4, {0, 1, 1, 2, 0, 1, 0}},
+    {4, {0, 1, 2, 1, 3, 0, 0}},
+    {6, {0, 1, 2, 3, 0, 1, 0}},
+    {6, {0, 2, 2, 2, 2, 2, 1}}
+};
 
-bool has_required_resources(tile_t *tile, int level, const int
-    elevation_requirements[][8])
+static bool can_elevate(map_t *map, size_t tile, int level)
 {
+    const elevation_t *requirement;
+
+    if (level < 1 || level >= LEVEL_MAX)
+        return false;
+    requirement = &ELEVATION[level - 1];
+    if (get_tile_level_count(map, tile, level) < requirement->players)
+        return false;
     for (int i = 0; i < RESOURCE_COUNT; i++) {
-        if (tile->resources[i] < elevation_requirements[level][i]) {
+        if (get_tile_resource(map, tile, i) < requirement->resources[i])
             return false;
-        }
     }
     return true;
 }
 
-int count_same_level_players(tile_t *tile, int level)
+void join_incantation(player_t *leader, player_t *player)
 {
-    int count = 0;
-
-    for (list_t *node = tile->players_on_tile; node; node = node->next) {
-        printf("player %d\n", node->player->level);
-        if (node->player && node->player->level == level)
-            count++;
-    }
-    return count;
+    player->ritual = leader;
+    player->ritual_prev = leader;
+    player->ritual_next = leader->ritual_next;
+    if (leader->ritual_next)
+        leader->ritual_next->ritual_prev = player;
+    leader->ritual_next = player;
 }
 
-static void start_level_up(tile_t *tile, int level)
+static void start_ritual(map_t *map, player_t *leader)
 {
-    for (list_t *node = tile->players_on_tile; node; node = node->next) {
-        if (node->player && node->player->level == level) {
-            node->player->is_incanting = true;
-            node->player->is_waiting_level_up = true;
-        }
+    leader->ritual = leader;
+    leader->ritual_prev = NULL;
+    leader->ritual_next = NULL;
+    for (player_t *p = get_tile_players(map, leader->tile); p;
+        p = p->tile_next) {
+        if (p != leader && !p->ritual && p->level == leader->level)
+            join_incantation(leader, p);
     }
 }
 
-void prepare_incantation(player_t *player, server_t *server, char *response)
+static void unlink_ritual(player_t *player)
 {
-    tile_t *tile = get_tile(server->map, player->x, player->y);
-    int level = player->level;
-    const int elevation_requirements[8][RESOURCE_COUNT + 1] = {
-            {0, 0, 0, 0, 0, 0, 0, 1}, {0, 1, 0, 0, 0, 0, 0, 1},
-            {0, 1, 1, 1, 0, 0, 0, 2}, {0, 2, 0, 1, 0, 2, 0, 2},
-            {0, 1, 1, 2, 0, 1, 0, 4}, {0, 1, 2, 1, 3, 0, 0, 4},
-            {0, 1, 2, 3, 0, 1, 0, 6}, {0, 2, 2, 2, 2, 2, 1, 6}
-    };
-    int required_players = elevation_requirements[level][RESOURCE_COUNT];
-
-    if (level >= 8 || !has_required_resources(tile, level,
-        elevation_requirements) || count_same_level_players(tile, level) <
-        required_players) {
-        strcpy(response, "ko\n");
-        return;
-    }
-    start_level_up(tile, level);
-    add_action_to_queue(player, "Incantation", server->freq);
-    strcpy(response, "Elevation underway\n");
-    send_gui_pic(server, player);
+    if (player->ritual_prev)
+        player->ritual_prev->ritual_next = player->ritual_next;
+    if (player->ritual_next)
+        player->ritual_next->ritual_prev = player->ritual_prev;
+    player->ritual = NULL;
+    player->ritual_prev = NULL;
+    player->ritual_next = NULL;
 }
 
-static void cancel_incantation(tile_t *tile, int level)
+static void end_ritual(server_t *server, player_t *leader, bool success)
 {
-    player_t *p;
+    size_t tile = leader->tile;
+    player_t *next;
+    char message[32];
 
-    for (list_t *node = tile->players_on_tile; node; node = node->next) {
-        p = node->player;
-        if (p && p->is_waiting_level_up && p->level == level) {
-            p->is_waiting_level_up = false;
-            p->is_incanting = false;
-            dprintf(p->socket, "ko\n");
+    for (player_t *p = leader; p; p = next) {
+        next = p->ritual_next;
+        unlink_ritual(p);
+        if (!success || !p->on_tile || p->tile != tile) {
+            client_send(server, p->socket, "ko\n", 3);
+            continue;
         }
+        raise_player_level(server, p);
+        snprintf(message, sizeof(message), "Current level: %d\n", p->level);
+        client_send(server, p->socket, message, strlen(message));
     }
 }
 
-static void increase_level(tile_t *tile, int level)
+void prepare_incantation(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
-    player_t *p;
-
-    for (list_t *node = tile->players_on_tile; node; node = node->next) {
-        p = node->player;
-        if (p && p->is_waiting_level_up && p->level == level) {
-            p->level++;
-            p->is_waiting_level_up = false;
-            p->is_incanting = false;
-            dprintf(p->socket, "Current level: %d\n", p->level);
-        }
+    (void)arg;
+    if (player->ritual ||
+        !can_elevate(server->map, player->tile, player->level)) {
+        strcpy(response, "ko\n");
+        return;
     }
+    start_ritual(server->map, player);
+    continue_action(player, CMD_ELEVATION);
+    strcpy(response, "Elevation underway\n");
+    send_gui_pic(server, player);
 }
 
-void finish_incantation(player_t *player, server_t *server)
+void finish_incantation(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
+    size_t tile = player->tile;
     int level = player->level;
-    tile_t *tile = get_tile(server->map, player->x, player->y);
-    const int elevation_requirements[8][RESOURCE_COUNT + 1] = {
-            {0, 0, 0, 0, 0, 0, 0, 1}, {0, 1, 0, 0, 0, 0, 0, 1},
-            {0, 1, 1, 1, 0, 0, 0, 2}, {0, 2, 0, 1, 0, 2, 0, 2},
-            {0, 1, 1, 2, 0, 1, 0, 4}, {0, 1, 2, 1, 3, 0, 0, 4},
-            {0, 1, 2, 3, 0, 1, 0, 6}, {0, 2, 2, 2, 2, 2, 1, 6}
-    };
-    int required_players = elevation_requirements[level][RESOURCE_COUNT];
 
-    if (!has_required_resources(tile, level, elevation_requirements) ||
-        count_same_level_players(tile, level) < required_players) {
-        cancel_incantation(tile, level);
+    (void)arg;
+    (void)response;
+    if (!can_elevate(server->map, tile, level)) {
+        end_ritual(server, player, false);
         send_gui_pie(server, player->x, player->y, 0);
         return;
     }
-    increase_level(tile, level);
     for (int i = 0; i < RESOURCE_COUNT; i++)
-        tile->resources[i] -= elevation_requirements[level][i];
+        tile_add_resource(server->map, tile, i,
+            -ELEVATION[level - 1].resources[i]);
+    end_ritual(server, player, true);
     send_gui_pie(server, player->x, player->y, 1);
 }
+
+void leave_incantation(server_t *server, player_t *player)
+{
+    if (!player->ritual)
+        return;
+    if (player->ritual != player) {
+        unlink_ritual(player);
+        return;
+    }
+    end_ritual(server, player, false);
+    send_gui_pie(server, player->x, player->y, 0);
+}
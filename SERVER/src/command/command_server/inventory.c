@@ -8,9 +8,13 @@
 #include "server.h"
 #include "player.h"
 #include "map/resource.h"
+#include "time/life.h"
 
-void handle_inventory_command(player_t *player, char *response)
+void handle_inventory_command(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
+    (void)arg;
+    get_player_food(server, player);
     snprintf(response, BUFFER_SIZE,
         "[ food %d, linemate %d, deraumere %d, sibur %d, "
             "mendiane %d, phiras %d, thystame %d ]\n",
@@ -8,106 +8,109 @@
 #include "server.h"
 #include "map/map.h"
 #include "map/resource.h"
-
-static void append_space_if_needed(char *buffer, int *first)
-{
-    if (!(*first))
-        strcat(buffer, " ");
-}
-
-static void append_tile_content(char *buffer, tile_t *tile)
-{
-    int first = 1;
-    static const char *RESOURCE_NAMES[] = {
-            "food", "linemate", "deraumere", "sibur", "mendiane", "phiras",
-            "thystame" };
-
-    for (list_t *node = tile->players_on_tile; node != NULL; node =
-            node->next) {
-        strcat(buffer, first ? "player" : " player");
-        first = 0;
+#include "utils/writer.h"
+
+static const signed char LOOK_OFFSETS[4][LOOK_CELLS_MAX][2] = {
+    [NORTH] = {
+        {0, 0},
+        {-1, -1}, {0, -1}, {1, -1},
+        {-2, -2}, {-1, -2}, {0, -2}, {1, -2}, {2, -2},
+        {-3, -3}, {-2, -3}, {-1, -3}, {0, -3}, {1, -3}, {2, -3}, {3, -3},
+        {-4, -4}, {-3, -4}, {-2, -4}, {-1, -4}, {0, -4}, {1, -4}, {2, -4},
+        {3, -4}, {4, -4},
+        {-5, -5}, {-4, -5}, {-3, -5}, {-2, -5}, {-1, -5}, {0, -5}, {1, -5},
+        {2, -5}, {3, -5}, {4, -5}, {5, -5},
+        {-6, -6}, {-5, -6}, {-4, -6}, {-3, -6}, {-2, -6}, {-1, -6}, {0, -6},
+        {1, -6}, {2, -6}, {3, -6}, {4, -6}, {5, -6}, {6, -6},
+        {-7, -7}, {-6, -7}, {-5, -7}, {-4, -7}, {-3, -7}, {-2, -7}, {-1, -7},
+        {0, -7}, {1, -7}, {2, -7}, {3, -7}, {4, -7}, {5, -7}, {6, -7},
+        {7, -7},
+        {-8, -8}, {-7, -8}, {-6, -8}, {-5, -8}, {-4, -8}, {-3, -8}, {-2, -8},
+        {-1, -8}, {0, -8}, {1, -8}, {2, -8}, {3, -8}, {4, -8}, {5, -8},
+        {6, -8}, {7, -8}, {8, -8}
+    },
+    [EAST] = {
+        {0, 0},
+        {1, -1}, {1, 0}, {1, 1},
+        {2, -2}, {2, -1}, {2, 0}, {2, 1}, {2, 2},
+        {3, -3}, {3, -2}, {3, -1}, {3, 0}, {3, 1}, {3, 2}, {3, 3},
+        {4, -4}, {4, -3}, {4, -2}, {4, -1}, {4, 0}, {4, 1}, {4, 2}, {4, 3},
+        {4, 4},
+        {5, -5}, {5, -4}, {5, -3}, {5, -2}, {5, -1}, {5, 0}, {5, 1}, {5, 2},
+        {5, 3}, {5, 4}, {5, 5},
+        {6, -6}, {6, -5}, {6, -4}, {6, -3}, {6, -2}, {6, -1}, {6, 0}, {6, 1},
+        {6, 2}, {6, 3}, {6, 4}, {6, 5}, {6, 6},
+        {7, -7}, {7, -6}, {7, -5}, {7, -4}, {7, -3}, {7, -2}, {7, -1},
+        {7, 0}, {7, 1}, {7, 2}, {7, 3}, {7, 4}, {7, 5}, {7, 6}, {7, 7},
+        {8, -8}, {8, -7}, {8, -6}, {8, -5}, {8, -4}, {8, -3}, {8, -2},
+        {8, -1}, {8, 0}, {8, 1}, {8, 2}, {8, 3}, {8, 4}, {8, 5}, {8, 6},
+        {8, 7}, {8, 8}
+    },
+    [SOUTH] = {
+        {0, 0},
+        {1, 1}, {0, 1}, {-1, 1},
+        {2, 2}, {1, 2}, {0, 2}, {-1, 2}, {-2, 2},
+        {3, 3}, {2, 3}, {1, 3}, {0, 3}, {-1, 3}, {-2, 3}, {-3, 3},
+        {4, 4}, {3, 4}, {2, 4}, {1, 4}, {0, 4}, {-1, 4}, {-2, 4}, {-3, 4},
+        {-4, 4},
+        {5, 5}, {4, 5}, {3, 5}, {2, 5}, {1, 5}, {0, 5}, {-1, 5}, {-2, 5},
+        {-3, 5}, {-4, 5}, {-5, 5},
+        {6, 6}, {5, 6}, {4, 6}, {3, 6}, {2, 6}, {1, 6}, {0, 6}, {-1, 6},
+        {-2, 6}, {-3, 6}, {-4, 6}, {-5, 6}, {-6, 6},
+        {7, 7}, {6, 7}, {5, 7}, {4, 7}, {3, 7}, {2, 7}, {1, 7}, {0, 7},
+        {-1, 7}, {-2, 7}, {-3, 7}, {-4, 7}, {-5, 7}, {-6, 7}, {-7, 7},
+        {8, 8}, {7, 8}, {6, 8}, {5, 8}, {4, 8}, {3, 8}, {2, 8}, {1, 8},
+        {0, 8}, {-1, 8}, {-2, 8}, {-3, 8}, {-4, 8}, {-5, 8}, {-6, 8},
+        {-7, 8}, {-8, 8}
+    },
+    [WEST] = {
+        {0, 0},
+        {-1, 1}, {-1, 0}, {-1, -1},
+        {-2, 2}, {-2, 1}, {-2, 0}, {-2, -1}, {-2, -2},
+        {-3, 3}, {-3, 2}, {-3, 1}, {-3, 0}, {-3, -1}, {-3, -2}, {-3, -3},
+        {-4, 4}, {-4, 3}, {-4, 2}, {-4, 1}, {-4, 0}, {-4, -1}, {-4, -2},
+        {-4, -3}, {-4, -4},
+        {-5, 5}, {-5, 4}, {-5, 3}, {-5, 2}, {-5, 1}, {-5, 0}, {-5, -1},
+        {-5, -2}, {-5, -3}, {-5, -4}, {-5, -5},
+        {-6, 6}, {-6, 5}, {-6, 4}, {-6, 3}, {-6, 2}, {-6, 1}, {-6, 0},
+        {-6, -1}, {-6, -2}, {-6, -3}, {-6, -4}, {-6, -5}, {-6, -6},
+        {-7, 7}, {-7, 6}, {-7, 5}, {-7, 4}, {-7, 3}, {-7, 2}, {-7, 1},
+        {-7, 0}, {-7, -1}, {-7, -2}, {-7, -3}, {-7, -4}, {-7, -5}, {-7, -6},
+        {-7, -7},
+        {-8, 8}, {-8, 7}, {-8, 6}, {-8, 5}, {-8, 4}, {-8, 3}, {-8, 2},
+        {-8, 1}, {-8, 0}, {-8, -1}, {-8, -2}, {-8, -3}, {-8, -4}, {-8, -5},
+        {-8, -6}, {-8, -7}, {-8, -8}
     }
-    for (int i = 0; i < RESOURCE_COUNT; i++) {
-        for (int j = 0; j < tile->resources[i]; j++) {
-            append_space_if_needed(buffer, &first);
-            strcat(buffer, RESOURCE_NAMES[i]);
-            first = 0;
-        }
-    }
-}
+};
 
-static tile_t *handle_north_orientation(player_t *player, server_t *server,
-    int depth, int offset)
+static size_t look_cell(map_t *map, player_t *player, int cell)
 {
-    int tx = player->x + offset;
-    int ty = player->y - depth;
+    const signed char *offset = LOOK_OFFSETS[player->orientation][cell];
 
-    return get_tile(server->map, tx, ty);
+    return get_tile_index(map, player->x + offset[0], player->y + offset[1]);
 }
 
-static tile_t *handle_south_orientation(player_t *player, server_t *server,
-    int depth, int offset)
+void handle_look_command(player_t *player, server_t *server,
+    const char *arg, char *response)
 {
-    int tx = player->x - offset;
-    int ty = player->y + depth;
-
-    return get_tile(server->map, tx, ty);
-}
-
-static tile_t *handle_east_orientation(player_t *player, server_t *server,
-    int depth, int offset)
-{
-    int tx = player->x + depth;
-    int ty = player->y + offset;
-
-    return get_tile(server->map, tx, ty);
-}
-
-static tile_t *handle_west_orientation(player_t *player, server_t *server,
-    int depth, int offset)
-{
-    int tx = player->x - depth;
-    int ty = player->y - offset;
-
-    return get_tile(server->map, tx, ty);
-}
-
-static tile_t *tile_orientation(player_t *player, server_t *server, int depth,
-    int offset)
-{
-    if (player->orientation == NORTH)
-        return handle_north_orientation(player, server, depth, offset);
-    if (player->orientation == SOUTH)
-        return handle_south_orientation(player, server, depth, offset);
-    if (player->orientation == EAST)
-        return handle_east_orientation(player, server, depth, offset);
-    return handle_west_orientation(player, server, depth, offset);
-}
-
-static void remove_trailing_comma(char *buffer)
-{
-    int len = strlen(buffer);
-
-    if (len > 1 && buffer[len - 1] == ',')
-        buffer[len - 1] = '\0';
-}
-
-void handle_look_command(player_t *player, server_t *server, char *response)
-{
-    char buffer[BUFFER_SIZE] = {0};
-    int level = player->level;
-
-    strcat(buffer, "[");
-    for (int depth = 0; depth <= level; depth++) {
-        for (int offset = -depth; offset <= depth; offset++) {
-            append_tile_content(buffer, tile_orientation(player, server,
-                    depth, offset));
-            strcat(buffer, ",");
-        }
+    writer_t *out = &server->scratch;
+    int level = player->level < LOOK_LEVEL_MAX ? player->level :
+        LOOK_LEVEL_MAX;
+    int cells = (level + 1) * (level + 1);
+
+    (void)arg;
+    writer_reset(out);
+    writer_append(out, "[", 1);
+    for (int cell = 0; cell < cells; cell++) {
+        if (cell > 0)
+            writer_append(out, ",", 1);
+        append_tile_text(server->map, look_cell(server->map, player, cell),
+            out);
+    }
+    writer_append(out, "]\n", 2);
+    if (out->failed) {
+        strcpy(response, "ko\n");
+        return;
     }
-    remove_trailing_comma(buffer);
-    strcat(buffer, "]\n");
-    printf("player x %d y %d\n", player->x, player->y);
-    printf("look: %s\n", buffer);
-    strcpy(response, buffer);
+    client_send(server, player->socket, out->data, out->len);
 }
@@ -9,20 +9,26 @@
 #include "server.h"
 #include "player.h"
 #include "command/gui_commands.h"
+#include "map/resource.h"
+#include "time/life.h"
 
 void handle_set_command(player_t *player, server_t *server, const char *item,
     char *response)
 {
-    tile_t *tile = &server->map->tiles[player->y][player->x];
+    size_t tile = get_tile_index(server->map, player->x, player->y);
     int resource_id = get_resource_id(item);
-    int player_id = player - server->players;
+    int player_id = get_player_id(player);
 
-    if (resource_id == -1 || player->inventory[resource_id] <= 0) {
+    get_player_food(server, player);
+    if (resource_id == -1 || player->inventory[resource_id] <= 0 ||
+        !tile_add_resource(server->map, tile, resource_id, 1)) {
         strcpy(response, "ko\n");
         return;
     }
-    player->inventory[resource_id]--;
-    tile->resources[resource_id]++;
+    if (resource_id == FOOD)
+        feed_player(server, player, -1);
+    else
+        player->inventory[resource_id]--;
     strcpy(response, "ok\n");
     send_gui_pdr(server, player_id, resource_id);
 }
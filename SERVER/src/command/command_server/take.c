@@ -8,37 +8,32 @@
 #include "server.h"
 #include "player.h"
 #include "command/gui_commands.h"
+#include "map/resource.h"
+#include "time/life.h"
 
-static void check_resource(tile_t *tile, player_t *player, char *response,
-    const char *item)
+static bool take_resource(server_t *server, size_t tile, player_t *player,
+    int id)
 {
-    int id = get_resource_id(item);
-
-    if (id == -1) {
-        strcpy(response, "ko\n");
-        return;
-    }
-    if (tile->resources[id] > 0) {
-        tile->resources[id]--;
+    if (!tile_add_resource(server->map, tile, id, -1))
+        return false;
+    if (id == FOOD)
+        feed_player(server, player, 1);
+    else
         player->inventory[id]++;
-    } else {
-        strcpy(response, "ko\n");
-    }
+    return true;
 }
 
 void handle_take_command(player_t *player, server_t *server, const char *item,
     char *response)
 {
-    tile_t *tile = &server->map->tiles[player->y][player->x];
+    size_t tile = get_tile_index(server->map, player->x, player->y);
     int resource_id = get_resource_id(item);
-    int player_id = player - server->players;
 
-    if (resource_id == -1) {
+    if (resource_id == -1 || !take_resource(server, tile, player,
+        resource_id)) {
         strcpy(response, "ko\n");
         return;
     }
     strcpy(response, "ok\n");
-    check_resource(tile, player, response, item);
-    if (strcmp(response, "ok\n") == 0)
-        send_gui_pgt(server, player_id, resource_id);
+    send_gui_pgt(server, get_player_id(player), resource_id);
 }
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** dormant.c
+*/
+
+#include "team.h"
+#include "server.h"
+#include "command/gui_commands.h"
+#include "time/tick.h"
+
+void add_dormant_player(server_t *server, player_t *player)
+{
+    team_t *team = &server->teams[player->team_id];
+
+    player->socket = -1;
+    player->dormant_tick = tick_now(server);
+    player->dormant_prev = NULL;
+    player->dormant_next = team->dormant;
+    if (team->dormant)
+        team->dormant->dormant_prev = player;
+    team->dormant = player;
+    team->dormant_count++;
+}
+
+void remove_dormant_player(server_t *server, player_t *player)
+{
+    team_t *team = &server->teams[player->team_id];
+
+    if (player->dormant_prev)
+        player->dormant_prev->dormant_next = player->dormant_next;
+    else
+        team->dormant = player->dormant_next;
+    if (player->dormant_next)
+        player->dormant_next->dormant_prev = player->dormant_prev;
+    player->dormant_prev = NULL;
+    player->dormant_next = NULL;
+    team->dormant_count--;
+}
+
+player_t *wake_dormant_player(server_t *server, int team_id,
+    int client_socket)
+{
+    player_t *player = server->teams[team_id].dormant;
+    action_t *action;
+
+    if (!player)
+        return NULL;
+    remove_dormant_player(server, player);
+    shift_player_ticks(player, tick_now(server) - player->dormant_tick);
+    player->socket = client_socket;
+    heap_set(&server->starvation, player->slot, player->starve_tick);
+    action = action_queue_front(&player->actions);
+    if (action)
+        heap_set(&server->action_timers, player->slot, action->end_tick);
+    send_gui_pnw(server, get_player_id(player));
+    return player;
+}
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** egg.c
+*/
+
+#include "server.h"
+#include "egg.h"
+#include "command/gui_commands.h"
+
+static void remove_egg(server_t *server, egg_t *egg)
+{
+    team_t *team = &server->teams[egg->team_id];
+
+    if (egg->team_prev)
+        egg->team_prev->team_next = egg->team_next;
+    else
+        team->eggs = egg->team_next;
+    if (egg->team_next)
+        egg->team_next->team_prev = egg->team_prev;
+    team->egg_count--;
+    remove_egg_from_tile(server->map, egg);
+    egg_release(server, egg);
+}
+
+egg_t *lay_egg(server_t *server, int team_id, int parent_id,
+    position_t pos)
+{
+    team_t *team = &server->teams[team_id];
+    size_t tile = get_tile_index(server->map, pos.x, pos.y);
+    egg_t *egg = get_chunk(server->map, tile) ? egg_alloc(server) : NULL;
+
+    if (!egg)
+        return NULL;
+    egg->id = server->next_egg_id;
+    server->next_egg_id++;
+    egg->parent_id = parent_id;
+    egg->team_id = team_id;
+    egg->x = pos.x;
+    egg->y = pos.y;
+    egg->team_next = team->eggs;
+    if (team->eggs)
+        team->eggs->team_prev = egg;
+    team->eggs = egg;
+    team->egg_count++;
+    add_egg_to_tile(server->map, tile, egg);
+    return egg;
+}
+
+bool hatch_egg(server_t *server, int team_id, position_t *pos)
+{
+    egg_t *egg = server->teams[team_id].eggs;
+
+    if (!egg)
+        return false;
+    pos->x = egg->x;
+    pos->y = egg->y;
+    send_gui_ebo(server, egg->id);
+    remove_egg(server, egg);
+    return true;
+}
+
+int destroy_tile_eggs(server_t *server, size_t tile)
+{
+    egg_t *egg = get_chunk(server->map, tile)->eggs[tile & CHUNK_MASK];
+    egg_t *next;
+    int count = 0;
+
+    for (; egg; egg = next) {
+        next = egg->tile_next;
+        send_gui_edi(server, egg->id);
+        remove_egg(server, egg);
+        count++;
+    }
+    return count;
+}
+
+void send_eggs_info(server_t *server, int graphic_fd)
+{
+    char buffer[128];
+
+    for (int t = 0; t < server->num_teams; t++) {
+        for (egg_t *egg = server->teams[t].eggs; egg; egg = egg->team_next) {
+            snprintf(buffer, sizeof(buffer), "enw #%d #%d %d %d\n", egg->id,
+                egg->parent_id, egg->x, egg->y);
+            client_send(server, graphic_fd, buffer, strlen(buffer));
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** egg_pool.c
+*/
+
+#include "server.h"
+#include "egg.h"
+
+egg_t *egg_alloc(server_t *server)
+{
+    egg_t *egg = server->free_eggs;
+
+    if (egg)
+        server->free_eggs = egg->team_next;
+    else
+        egg = malloc(sizeof(egg_t));
+    if (egg)
+        memset(egg, 0, sizeof(egg_t));
+    return egg;
+}
+
+void egg_release(server_t *server, egg_t *egg)
+{
+    egg->team_next = server->free_eggs;
+    server->free_eggs = egg;
+}
+
+static void free_egg_list(egg_t *egg)
+{
+    egg_t *next;
+
+    for (; egg; egg = next) {
+        next = egg->team_next;
+        free(egg);
+    }
+}
+
+void free_eggs(server_t *server)
+{
+    for (int i = 0; i < server->num_teams; i++) {
+        free_egg_list(server->teams[i].eggs);
+        server->teams[i].eggs = NULL;
+        server->teams[i].egg_count = 0;
+    }
+    free_egg_list(server->free_eggs);
+    server->free_eggs = NULL;
+}
+
+int init_eggs(server_t *server)
+{
+    position_t pos;
+
+    for (int t = 0; t < server->num_teams; t++) {
+        for (int i = 0; i < server->teams[t].max_clients; i++) {
+            pos.x = rng_below(&server->rng, server->width);
+            pos.y = rng_below(&server->rng, server->height);
+            if (!lay_egg(server, t, -1, pos))
+                return -1;
+        }
+    }
+    return 0;
+}
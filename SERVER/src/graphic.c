@@ -7,6 +7,9 @@
 
 #include "server.h"
 #include "command/gui_commands.h"
+#include "network/spectator.h"
+#include "egg.h"
+#include "journal/journal.h"
 
 void send_graphic_init_data(server_t *server, int graphic_fd)
 {
@@ -14,21 +17,28 @@ void send_graphic_init_data(server_t *server, int graphic_fd)
 
     snprintf(buffer, sizeof(buffer), "msz %d %d\n", server->width,
         server->height);
-    send(graphic_fd, buffer, strlen(buffer), 0);
+    client_send(server, graphic_fd, buffer, strlen(buffer));
     handle_gui_mct(server, graphic_fd);
     handle_gui_tna(server, graphic_fd);
     send_player_info(server, graphic_fd);
+    send_eggs_info(server, graphic_fd);
     snprintf(buffer, sizeof(buffer), "sgt %d\n", server->freq);
-    send(graphic_fd, buffer, strlen(buffer), 0);
+    client_send(server, graphic_fd, buffer, strlen(buffer));
 }
 
 void verif_graphic_connexion(server_t *server, int client_socket, char
     *buffer)
 {
+    client_t *client = client_get(server, client_socket);
+
     if (strcmp(buffer, "GRAPHIC") == 0) {
         printf("Client GRAPHIC connecté\n");
-        server->graphic_fd = client_socket;
+        if (!client)
+            return;
+        client->type = CLIENT_GRAPHIC;
+        journal_event(server, JOURNAL_SPECTATE, -1);
         send_graphic_init_data(server, client_socket);
+        spectator_add(server, client);
     } else {
         handle_team_authentication(server, client_socket, buffer);
     }
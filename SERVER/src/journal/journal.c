@@ -0,0 +1,154 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** journal.c
+*/
+
+#include <fcntl.h>
+#include "journal/journal.h"
+#include "time/tick.h"
+
+static void put_varint(writer_t *writer, uint64_t value)
+{
+    char bytes[10];
+    size_t len = 0;
+
+    while (value >= 0x80) {
+        bytes[len] = (char)(value & 0x7f) | (char)0x80;
+        value >>= 7;
+        len++;
+    }
+    bytes[len] = (char)value;
+    writer_append(writer, bytes, len + 1);
+}
+
+static void stop_journal(server_t *server)
+{
+    journal_t *journal = server->journal;
+
+    if (ftruncate(journal->fd, (off_t)journal->size) < 0)
+        perror(server->journal_path);
+    close(journal->fd);
+    writer_free(&journal->buffer);
+    free(journal);
+    server->journal = NULL;
+}
+
+static int flush_journal(server_t *server)
+{
+    journal_t *journal = server->journal;
+    size_t done = 0;
+    ssize_t written;
+
+    while (done < journal->buffer.len) {
+        written = write(journal->fd, journal->buffer.data + done,
+            journal->buffer.len - done);
+        if (written <= 0) {
+            fprintf(stderr, "Cannot write journal %s, recording stopped\n",
+                server->journal_path);
+            stop_journal(server);
+            return -1;
+        }
+        done += (size_t)written;
+    }
+    journal->size += done;
+    writer_reset(&journal->buffer);
+    journal->flushed_tick = journal->tick;
+    return 0;
+}
+
+static void fill_journal_header(server_t *server, journalheader_t *header)
+{
+    memset(header, 0, sizeof(journalheader_t));
+    memcpy(header->magic, JOURNAL_MAGIC, sizeof(header->magic));
+    header->version = JOURNAL_VERSION;
+    header->restored = server->restore_path != NULL;
+    header->width = server->width;
+    header->height = server->height;
+    header->freq = server->freq;
+    header->clients_nb = server->teams[0].max_clients;
+    header->num_teams = server->num_teams;
+    header->seed = server->seed;
+    header->start_tick = tick_now(server);
+    for (int t = 0; t < server->num_teams; t++)
+        memcpy(header->teams[t], server->teams[t].name, MAX_TEAM_NAME);
+}
+
+int open_journal(server_t *server, const char *path)
+{
+    journal_t *journal = calloc(1, sizeof(journal_t));
+    journalheader_t header;
+
+    if (!journal)
+        return -1;
+    journal->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (journal->fd < 0) {
+        fprintf(stderr, "Cannot open journal %s\n", path);
+        free(journal);
+        return -1;
+    }
+    fill_journal_header(server, &header);
+    writer_append(&journal->buffer, (const char *)&header, sizeof(header));
+    journal->tick = header.start_tick;
+    server->journal = journal;
+    return flush_journal(server);
+}
+
+void close_journal(server_t *server)
+{
+    if (server->journal && flush_journal(server) == 0)
+        stop_journal(server);
+}
+
+void journal_tick(server_t *server, uint64_t tick)
+{
+    journal_t *journal = server->journal;
+
+    if (!journal || tick == journal->tick)
+        return;
+    writer_append(&journal->buffer, (char []){JOURNAL_TICK}, 1);
+    put_varint(&journal->buffer, tick - journal->tick);
+    journal->tick = tick;
+}
+
+void journal_event(server_t *server, journalrecord_t type, int slot)
+{
+    journal_t *journal = server->journal;
+
+    if (!journal)
+        return;
+    writer_append(&journal->buffer, (char []){(char)type}, 1);
+    if (type == JOURNAL_LEAVE)
+        put_varint(&journal->buffer, (uint64_t)slot);
+    if (type == JOURNAL_STEP && (journal->buffer.len >= JOURNAL_FLUSH_SIZE
+        || journal->tick >= journal->flushed_tick + server->freq))
+        flush_journal(server);
+}
+
+void journal_join(server_t *server, int socket, int team_id, int slot)
+{
+    journal_t *journal = server->journal;
+
+    if (!journal)
+        return;
+    writer_append(&journal->buffer, (char []){JOURNAL_JOIN}, 1);
+    put_varint(&journal->buffer, (uint64_t)team_id);
+    put_varint(&journal->buffer, (uint64_t)socket);
+    put_varint(&journal->buffer, (uint64_t)slot);
+}
+
+void journal_text(server_t *server, journalrecord_t type, int slot,
+    const char *text)
+{
+    journal_t *journal = server->journal;
+    size_t len = strlen(text);
+
+    if (!journal)
+        return;
+    writer_append(&journal->buffer, (char []){(char)type}, 1);
+    if (type == JOURNAL_COMMAND)
+        put_varint(&journal->buffer, (uint64_t)slot);
+    put_varint(&journal->buffer, len);
+    writer_append(&journal->buffer, text, len);
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** replay.c
+*/
+
+#include "journal/journal.h"
+#include "time/tick.h"
+#include "utils/mapped_file.h"
+
+static bool valid_journal_header(server_t *server,
+    const journalheader_t *header)
+{
+    if (memcmp(header->magic, JOURNAL_MAGIC, sizeof(header->magic)) ||
+        header->version != JOURNAL_VERSION)
+        return false;
+    if (header->width < 1 || header->width > MAP_SIZE_MAX ||
+        header->height < 1 || header->height > MAP_SIZE_MAX ||
+        header->freq < 1 || header->num_teams < 1 ||
+        header->num_teams > MAX_TEAMS)
+        return false;
+    return header->restored == (server->restore_path != NULL);
+}
+
+static int start_replay(server_t *server, const journalheader_t *header)
+{
+    if (!valid_journal_header(server, header)) {
+        fprintf(stderr, "Invalid journal %s\n", server->replay_path);
+        return -1;
+    }
+    server->width = header->width;
+    server->height = header->height;
+    server->freq = header->freq;
+    server->seed = header->seed;
+    server->num_teams = 0;
+    for (int t = 0; t < header->num_teams; t++)
+        add_team_name(server, header->teams[t]);
+    set_team_max_clients(server, header->clients_nb);
+    if (init_state(server) < 0)
+        return -1;
+    if (tick_now(server) == header->start_tick)
+        return 0;
+    fprintf(stderr, "Journal does not start from this checkpoint\n");
+    return -1;
+}
+
+static int run_replay(server_t *server, replay_t *replay)
+{
+    uint64_t start = clock_now_ns();
+
+    while (replay->pos < replay->size && !replay->failed) {
+        apply_journal_record(server, replay);
+        replay->records++;
+    }
+    if (replay->failed) {
+        fprintf(stderr, "Journal replay failed at record %zu\n",
+            replay->records);
+        return -1;
+    }
+    if (server->winner >= 0)
+        end_game(server);
+    printf("Replayed %zu records up to tick %llu in %.3f s\n"
+        "Slowest step: tick %llu, %.3f ms\n", replay->records,
+        (unsigned long long)tick_now(server),
+        (double)(clock_now_ns() - start) / NS_PER_SEC,
+        (unsigned long long)replay->slowest_tick,
+        (double)replay->slowest_ns / NS_PER_MS);
+    return 0;
+}
+
+int replay_journal(server_t *server)
+{
+    replay_t replay = {.pos = sizeof(journalheader_t)};
+    int status = -1;
+
+    server->server_socket = -1;
+    server->epoll_fd = -1;
+    replay.data = map_file(server->replay_path, &replay.size);
+    if (!replay.data) {
+        fprintf(stderr, "Cannot read journal %s\n", server->replay_path);
+        return -1;
+    }
+    if (replay.size >= sizeof(journalheader_t) &&
+        start_replay(server, (const journalheader_t *)replay.data) == 0)
+        status = run_replay(server, &replay);
+    else if (replay.size < sizeof(journalheader_t))
+        fprintf(stderr, "Invalid journal %s\n", server->replay_path);
+    unmap_file(replay.data, replay.size);
+    cleanup_server(server);
+    return status;
+}
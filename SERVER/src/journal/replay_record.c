@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** replay_record.c
+*/
+
+#include <limits.h>
+#include "journal/journal.h"
+#include "time/tick.h"
+#include "graphic.h"
+#include "command/gui_commands.h"
+
+static uint64_t read_varint(replay_t *replay)
+{
+    uint64_t value = 0;
+    uint8_t byte;
+
+    for (int shift = 0; shift < 64 && replay->pos < replay->size;
+        shift += 7) {
+        byte = replay->data[replay->pos];
+        replay->pos++;
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    replay->failed = true;
+    return 0;
+}
+
+static char *read_text(replay_t *replay, char *line)
+{
+    uint64_t len = read_varint(replay);
+
+    if (replay->failed || len > CLIENT_INPUT_SIZE ||
+        len > replay->size - replay->pos) {
+        replay->failed = true;
+        return NULL;
+    }
+    memcpy(line, replay->data + replay->pos, len);
+    line[len] = '\0';
+    replay->pos += len;
+    return line;
+}
+
+static player_t *read_player(server_t *server, replay_t *replay)
+{
+    uint64_t slot = read_varint(replay);
+
+    if (replay->failed || slot >= MAX_CLIENTS ||
+        !server->players[slot].active) {
+        replay->failed = true;
+        return NULL;
+    }
+    return &server->players[slot];
+}
+
+static void replay_join(server_t *server, replay_t *replay)
+{
+    uint64_t team_id = read_varint(replay);
+    uint64_t socket = read_varint(replay);
+    uint64_t slot = read_varint(replay);
+
+    if (replay->failed || team_id >= (uint64_t)server->num_teams ||
+        socket > INT_MAX || slot >= MAX_CLIENTS ||
+        server->teams[team_id].egg_count +
+        server->teams[team_id].dormant_count == 0) {
+        replay->failed = true;
+        return;
+    }
+    handle_team_join_success(server, (int)socket, (int)team_id,
+        server->teams[team_id].name);
+    if (!server->players[slot].active ||
+        server->players[slot].socket != (int)socket)
+        replay->failed = true;
+}
+
+static void replay_step(server_t *server, replay_t *replay)
+{
+    uint64_t start = clock_now_ns();
+    uint64_t elapsed;
+
+    process_pending_action(server);
+    update_ticks(server);
+    elapsed = clock_now_ns() - start;
+    if (elapsed > replay->slowest_ns) {
+        replay->slowest_ns = elapsed;
+        replay->slowest_tick = tick_now(server);
+    }
+}
+
+static void replay_player_record(server_t *server, replay_t *replay,
+    int type)
+{
+    char line[CLIENT_INPUT_SIZE + 1];
+    player_t *player;
+
+    if (type == JOURNAL_JOIN) {
+        replay_join(server, replay);
+        return;
+    }
+    player = read_player(server, replay);
+    if (!player)
+        return;
+    if (type == JOURNAL_LEAVE)
+        remove_player(server, player->slot);
+    else if (read_text(replay, line))
+        add_action_to_queue(server, player, line);
+}
+
+void apply_journal_record(server_t *server, replay_t *replay)
+{
+    char line[CLIENT_INPUT_SIZE + 1];
+    int type = replay->data[replay->pos];
+
+    replay->pos++;
+    if (type == JOURNAL_TICK)
+        server->tick_count += read_varint(replay);
+    if (type == JOURNAL_STEP)
+        replay_step(server, replay);
+    if (type == JOURNAL_JOIN || type == JOURNAL_COMMAND ||
+        type == JOURNAL_LEAVE)
+        replay_player_record(server, replay, type);
+    if (type == JOURNAL_SPECTATE)
+        send_graphic_init_data(server, -1);
+    if (type == JOURNAL_GUI && read_text(replay, line))
+        process_gui_command(server, -1, line);
+    if (type >= JOURNAL_RECORD_COUNT)
+        replay->failed = true;
+}
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** chunk.c
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "map/map.h"
+#include "map/resource.h"
+
+int reserve_live_chunks(map_t *map, size_t extra)
+{
+    size_t capacity = map->live_capacity ? map->live_capacity : 16;
+    size_t *grown;
+
+    if (map->live_count + extra <= map->live_capacity)
+        return 0;
+    while (capacity < map->live_count + extra)
+        capacity *= 2;
+    grown = realloc(map->live_chunks, sizeof(size_t) * capacity);
+    if (!grown)
+        return -1;
+    map->live_chunks = grown;
+    map->live_capacity = capacity;
+    return 0;
+}
+
+static void place_chunk_resource(mapchunk_t *chunk, rng_t *rng,
+    int extent[2], int type)
+{
+    size_t local = (rng_below(rng, extent[1]) << CHUNK_SHIFT) |
+        rng_below(rng, extent[0]);
+
+    chunk->resources[type][local]++;
+}
+
+static int round_count(rng_t *rng, double target)
+{
+    int count = (int)target;
+
+    if ((rng_next(rng) >> 11) * 0x1p-53 < target - count)
+        count++;
+    return count;
+}
+
+void fill_chunk(map_t *map, size_t chunk_id, mapchunk_t *chunk,
+    int64_t *totals)
+{
+    uint64_t key = chunk_id;
+    rng_t rng;
+    int extent[2];
+    int count;
+
+    memset(chunk, 0, sizeof(mapchunk_t));
+    rng_seed(&rng, map->seed ^ splitmix64(&key));
+    get_chunk_extent(map, chunk_id, &extent[0], &extent[1]);
+    for (int r = 0; r < RESOURCE_COUNT; r++) {
+        count = round_count(&rng, RESOURCE_DENSITY[r] * extent[0] * extent[1]);
+        for (int i = 0; i < count; i++)
+            place_chunk_resource(chunk, &rng, extent, r);
+        totals[r] += count;
+    }
+}
+
+mapchunk_t *generate_chunk(map_t *map, size_t chunk_id, int64_t *totals)
+{
+    mapchunk_t *chunk = aligned_alloc(MAP_ALIGNMENT, CHUNK_ALLOC_SIZE);
+
+    if (chunk)
+        fill_chunk(map, chunk_id, chunk, totals);
+    return chunk;
+}
+
+void adopt_chunk(map_t *map, size_t chunk_id, mapchunk_t *chunk)
+{
+    int width;
+    int height;
+
+    get_chunk_extent(map, chunk_id, &width, &height);
+    map->materialized_tiles += (size_t)width * height;
+    map->live_chunks[map->live_count] = chunk_id;
+    map->live_count++;
+    map->chunks[chunk_id] = chunk;
+}
+
+static mapchunk_t *materialize_chunk(map_t *map, size_t chunk_id)
+{
+    mapchunk_t *chunk = NULL;
+
+    if (reserve_live_chunks(map, 1) == 0)
+        chunk = generate_chunk(map, chunk_id, map->totals);
+    if (!chunk) {
+        fprintf(stderr, "Out of memory while generating a map chunk\n");
+        return NULL;
+    }
+    adopt_chunk(map, chunk_id, chunk);
+    return chunk;
+}
+
+mapchunk_t *get_chunk(map_t *map, size_t tile)
+{
+    size_t chunk_id = tile >> (2 * CHUNK_SHIFT);
+    mapchunk_t *chunk = map->chunks[chunk_id];
+
+    if (chunk)
+        return chunk;
+    return materialize_chunk(map, chunk_id);
+}
+
+void get_chunk_extent(map_t *map, size_t chunk_id, int *width, int *height)
+{
+    int cx = (int)(chunk_id % map->chunks_w) << CHUNK_SHIFT;
+    int cy = (int)(chunk_id / map->chunks_w) << CHUNK_SHIFT;
+
+    *width = map->width - cx < CHUNK_SIZE ? map->width - cx : CHUNK_SIZE;
+    *height = map->height - cy < CHUNK_SIZE ? map->height - cy : CHUNK_SIZE;
+}
+
+const mapchunk_t *peek_chunk(map_t *map, size_t chunk_id)
+{
+    int64_t totals[RESOURCE_COUNT] = {0};
+
+    if (map->chunks[chunk_id])
+        return map->chunks[chunk_id];
+    if (map->scratch_id == chunk_id)
+        return map->scratch;
+    if (!map->scratch)
+        map->scratch = aligned_alloc(MAP_ALIGNMENT, CHUNK_ALLOC_SIZE);
+    if (!map->scratch)
+        return NULL;
+    fill_chunk(map, chunk_id, map->scratch, totals);
+    map->scratch_id = chunk_id;
+    return map->scratch;
+}
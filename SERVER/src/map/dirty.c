@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** dirty.c
+*/
+
+#include "server.h"
+#include "network/spectator.h"
+#include "utils/format.h"
+
+static int list_dirty_chunk(map_t *map, size_t chunk_id)
+{
+    size_t capacity = map->dirty_capacity ? map->dirty_capacity * 2 : 16;
+    size_t *grown;
+
+    if (map->dirty_count == map->dirty_capacity) {
+        grown = realloc(map->dirty_chunks, sizeof(size_t) * capacity);
+        if (!grown)
+            return -1;
+        map->dirty_chunks = grown;
+        map->dirty_capacity = capacity;
+    }
+    map->dirty_chunks[map->dirty_count] = chunk_id;
+    map->dirty_count++;
+    return 0;
+}
+
+void mark_tile_dirty(map_t *map, mapchunk_t *chunk, size_t tile)
+{
+    size_t local = tile & CHUNK_MASK;
+
+    chunk->dirty[local / 64] |= 1ULL << (local % 64);
+    if (!chunk->dirty_listed &&
+        list_dirty_chunk(map, tile >> (2 * CHUNK_SHIFT)) == 0)
+        chunk->dirty_listed = true;
+}
+
+static void format_dirty_word(map_t *map, size_t chunk_id, int word,
+    writer_t *out)
+{
+    uint64_t bits = map->chunks[chunk_id]->dirty[word];
+    int cx = (int)(chunk_id % map->chunks_w) << CHUNK_SHIFT;
+    int cy = (int)(chunk_id / map->chunks_w) << CHUNK_SHIFT;
+    int local;
+
+    while (bits && writer_reserve(out, BCT_LINE_MAX)) {
+        local = word * 64 + __builtin_ctzll(bits);
+        bits &= bits - 1;
+        out->len += format_bct(out->data + out->len, map->chunks[chunk_id],
+            cx + (local & (CHUNK_SIZE - 1)), cy + (local >> CHUNK_SHIFT));
+    }
+}
+
+static void drain_dirty_chunk(server_t *server, size_t chunk_id,
+    writer_t *out)
+{
+    mapchunk_t *chunk = server->map->chunks[chunk_id];
+
+    for (int word = 0; word < DIRTY_WORDS; word++) {
+        if (chunk->dirty[word] && server->spectators)
+            format_dirty_word(server->map, chunk_id, word, out);
+        chunk->dirty[word] = 0;
+    }
+    chunk->dirty_listed = false;
+}
+
+void flush_dirty_tiles(server_t *server)
+{
+    map_t *map = server->map;
+    writer_t *out = &server->scratch;
+
+    writer_reset(out);
+    for (size_t i = 0; i < map->dirty_count; i++)
+        drain_dirty_chunk(server, map->dirty_chunks[i], out);
+    map->dirty_count = 0;
+    if (!out->failed)
+        spectator_broadcast(server, out->data, out->len);
+}
@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** generation.c
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "map/map.h"
+
+static void *run_worker(void *arg)
+{
+    generationworker_t *worker = arg;
+    map_t *map = worker->map;
+
+    for (size_t id = worker->first; id < worker->first + worker->count;
+        id++) {
+        map->chunks[id] = generate_chunk(map, id, worker->totals);
+        if (!map->chunks[id])
+            return NULL;
+    }
+    return NULL;
+}
+
+static int split_work(generationworker_t *workers, map_t *map)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t count = map->chunk_count;
+    size_t n = count / GENERATION_CHUNKS_MIN;
+
+    if (n > (size_t)(cpus > 1 ? cpus : 1))
+        n = cpus > 1 ? cpus : 1;
+    if (n > GENERATION_THREADS_MAX)
+        n = GENERATION_THREADS_MAX;
+    if (n == 0)
+        n = 1;
+    for (size_t k = 0; k < n; k++) {
+        workers[k].map = map;
+        workers[k].first = count * k / n;
+        workers[k].count = count * (k + 1) / n - count * k / n;
+    }
+    return (int)n;
+}
+
+static void run_workers(generationworker_t *workers, int n)
+{
+    int started = 1;
+
+    while (started < n && pthread_create(&workers[started].thread, NULL,
+        run_worker, &workers[started]) == 0)
+        started++;
+    run_worker(&workers[0]);
+    for (int k = started; k < n; k++)
+        run_worker(&workers[k]);
+    for (int k = 1; k < started; k++)
+        pthread_join(workers[k].thread, NULL);
+}
+
+static int merge_workers(map_t *map, generationworker_t *workers, int n)
+{
+    int status = 0;
+    size_t id;
+
+    for (int k = 0; k < n; k++) {
+        for (int r = 0; r < RESOURCE_COUNT; r++)
+            map->totals[r] += workers[k].totals[r];
+        for (size_t i = 0; i < workers[k].count; i++) {
+            id = workers[k].first + i;
+            status = map->chunks[id] ? status : -1;
+            if (map->chunks[id])
+                adopt_chunk(map, id, map->chunks[id]);
+        }
+    }
+    return status;
+}
+
+int materialize_map(map_t *map)
+{
+    generationworker_t workers[GENERATION_THREADS_MAX] = {0};
+    int n;
+
+    if (reserve_live_chunks(map, map->chunk_count) < 0)
+        return -1;
+    n = split_work(workers, map);
+    run_workers(workers, n);
+    if (merge_workers(map, workers, n) < 0) {
+        fprintf(stderr, "Out of memory while generating the map\n");
+        return -1;
+    }
+    return 0;
+}
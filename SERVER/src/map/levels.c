@@ -0,0 +1,29 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** levels.c
+*/
+
+#include "map/map.h"
+#include "player.h"
+
+void set_player_level(map_t *map, player_t *player, int level)
+{
+    mapchunk_t *chunk;
+    size_t local = player->tile & CHUNK_MASK;
+
+    if (player->on_tile) {
+        chunk = get_chunk(map, player->tile);
+        chunk->levels[player->level - 1][local]--;
+        chunk->levels[level - 1][local]++;
+    }
+    player->level = level;
+}
+
+int get_tile_level_count(map_t *map, size_t tile, int level)
+{
+    if (level < 1 || level > LEVEL_MAX)
+        return 0;
+    return get_chunk(map, tile)->levels[level - 1][tile & CHUNK_MASK];
+}
@@ -9,34 +9,74 @@
 #include "server.h"
 #include "map/resource.h"
 
-static void init_tile(tile_t *tile)
+static int alloc_map_state(map_t *map)
 {
-    memset(tile, 0, sizeof(tile_t));
-    tile->resources = malloc(sizeof(int) * RESOURCE_COUNT);
-    for (int r = 0; r < RESOURCE_COUNT; r++) {
-        tile->resources[r] = 0;
-    }
-    tile->players_on_tile = NULL;
-}
-
-static void init_map_row(tile_t *row, int width)
-{
-    for (int x = 0; x < width; x++) {
-        init_tile(&row[x]);
-    }
+    map->chunks = calloc(map->chunk_count, sizeof(mapchunk_t *));
+    map->fragments = malloc(sizeof(tilefragment_t) * TILE_FRAGMENT_CACHE);
+    if (!map->chunks || !map->fragments)
+        return -1;
+    for (int i = 0; i < TILE_FRAGMENT_CACHE; i++)
+        map->fragments[i].tile = SIZE_MAX;
+    map->scratch_id = SIZE_MAX;
+    return 0;
 }
 
-void init_map(server_t *server)
+int init_map(server_t *server)
 {
-    map_t *map = malloc(sizeof(map_t));
+    map_t *map = calloc(1, sizeof(map_t));
 
+    if (!map)
+        return -1;
     map->width = server->width;
     map->height = server->height;
-    map->tiles = malloc(sizeof(tile_t *) * map->height);
-    for (int y = 0; y < map->height; y++) {
-        map->tiles[y] = malloc(sizeof(tile_t) * map->width);
-        init_map_row(map->tiles[y], map->width);
+    map->chunks_w = (map->width + CHUNK_SIZE - 1) >> CHUNK_SHIFT;
+    map->chunks_h = (map->height + CHUNK_SIZE - 1) >> CHUNK_SHIFT;
+    map->tile_count = (size_t)map->width * map->height;
+    map->chunk_count = (size_t)map->chunks_w * map->chunks_h;
+    map->seed = server->seed;
+    if (alloc_map_state(map) < 0 || (!server->restore_path &&
+        map->chunk_count <= MAP_EAGER_CHUNKS && materialize_map(map) < 0)) {
+        free_map(map);
+        return -1;
     }
-    init_ressources(map);
     server->map = map;
+    return 0;
+}
+
+void free_map(map_t *map)
+{
+    if (!map)
+        return;
+    for (size_t i = 0; i < map->live_count; i++)
+        free(map->chunks[map->live_chunks[i]]);
+    free(map->chunks);
+    free(map->live_chunks);
+    free(map->dirty_chunks);
+    free(map->fragments);
+    free(map->scratch);
+    free(map);
+}
+
+int wrap_coord(int value, int size)
+{
+    if (value >= 0 && value < size)
+        return value;
+    value %= size;
+    return value < 0 ? value + size : value;
+}
+
+size_t get_tile_at(map_t *map, int x, int y)
+{
+    size_t chunk_id = (size_t)(y >> CHUNK_SHIFT) * map->chunks_w +
+        (x >> CHUNK_SHIFT);
+    size_t local = ((y & (CHUNK_SIZE - 1)) << CHUNK_SHIFT) |
+        (x & (CHUNK_SIZE - 1));
+
+    return (chunk_id << (2 * CHUNK_SHIFT)) | local;
+}
+
+size_t get_tile_index(map_t *map, int x, int y)
+{
+    return get_tile_at(map, wrap_coord(x, map->width),
+        wrap_coord(y, map->height));
 }
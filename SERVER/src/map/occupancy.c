@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** occupancy.c
+*/
+
+#include "map/map.h"
+#include "player.h"
+#include "egg.h"
+
+void add_player_to_tile(map_t *map, size_t tile, player_t *player)
+{
+    mapchunk_t *chunk = get_chunk(map, tile);
+    size_t local = tile & CHUNK_MASK;
+    player_t *head = chunk->occupants[local];
+
+    player->tile = tile;
+    player->tile_prev = NULL;
+    player->tile_next = head;
+    if (head)
+        head->tile_prev = player;
+    chunk->occupants[local] = player;
+    chunk->occupant_count[local]++;
+    chunk->levels[player->level - 1][local]++;
+    chunk->versions[local]++;
+    player->on_tile = true;
+}
+
+void remove_player_from_tile(map_t *map, player_t *player)
+{
+    mapchunk_t *chunk;
+    size_t local = player->tile & CHUNK_MASK;
+
+    if (!player->on_tile)
+        return;
+    chunk = get_chunk(map, player->tile);
+    if (player->tile_prev)
+        player->tile_prev->tile_next = player->tile_next;
+    else
+        chunk->occupants[local] = player->tile_next;
+    if (player->tile_next)
+        player->tile_next->tile_prev = player->tile_prev;
+    chunk->occupant_count[local]--;
+    chunk->levels[player->level - 1][local]--;
+    chunk->versions[local]++;
+    player->tile_prev = NULL;
+    player->tile_next = NULL;
+    player->on_tile = false;
+}
+
+bool place_player(map_t *map, player_t *player, int x, int y)
+{
+    int wrapped_x = wrap_coord(x, map->width);
+    int wrapped_y = wrap_coord(y, map->height);
+    size_t tile = get_tile_at(map, wrapped_x, wrapped_y);
+
+    if (!get_chunk(map, tile))
+        return false;
+    player->x = wrapped_x;
+    player->y = wrapped_y;
+    if (player->on_tile && player->tile == tile)
+        return true;
+    remove_player_from_tile(map, player);
+    add_player_to_tile(map, tile, player);
+    return true;
+}
+
+void add_egg_to_tile(map_t *map, size_t tile, egg_t *egg)
+{
+    mapchunk_t *chunk = get_chunk(map, tile);
+    egg_t *head = chunk->eggs[tile & CHUNK_MASK];
+
+    egg->tile = tile;
+    egg->tile_prev = NULL;
+    egg->tile_next = head;
+    if (head)
+        head->tile_prev = egg;
+    chunk->eggs[tile & CHUNK_MASK] = egg;
+}
+
+void remove_egg_from_tile(map_t *map, egg_t *egg)
+{
+    mapchunk_t *chunk = get_chunk(map, egg->tile);
+
+    if (egg->tile_prev)
+        egg->tile_prev->tile_next = egg->tile_next;
+    else
+        chunk->eggs[egg->tile & CHUNK_MASK] = egg->tile_next;
+    if (egg->tile_next)
+        egg->tile_next->tile_prev = egg->tile_prev;
+    egg->tile_prev = NULL;
+    egg->tile_next = NULL;
+}
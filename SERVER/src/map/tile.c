@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** tile.c
+*/
+
+#include "map/map.h"
+
+int get_tile_resource(map_t *map, size_t tile, int type)
+{
+    return get_chunk(map, tile)->resources[type][tile & CHUNK_MASK];
+}
+
+bool tile_add_resource(map_t *map, size_t tile, int type, int delta)
+{
+    mapchunk_t *chunk = get_chunk(map, tile);
+    size_t local = tile & CHUNK_MASK;
+    int value = chunk->resources[type][local] + delta;
+
+    if (value < 0 || value > TILE_COUNT_MAX)
+        return false;
+    chunk->resources[type][local] = (tilecount_t)value;
+    chunk->versions[local]++;
+    map->totals[type] += delta;
+    mark_tile_dirty(map, chunk, tile);
+    return true;
+}
+
+player_t *get_tile_players(map_t *map, size_t tile)
+{
+    return get_chunk(map, tile)->occupants[tile & CHUNK_MASK];
+}
+
+int get_tile_player_count(map_t *map, size_t tile)
+{
+    return get_chunk(map, tile)->occupant_count[tile & CHUNK_MASK];
+}
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** tile_text.c
+*/
+
+#include <string.h>
+#include "map/map.h"
+#include "utils/writer.h"
+
+static const char *const RESOURCE_NAMES[RESOURCE_COUNT] = {
+    "food", "linemate", "deraumere", "sibur", "mendiane", "phiras",
+    "thystame"
+};
+
+static void append_word(writer_t *out, const char *word, size_t start)
+{
+    if (out->len > start)
+        writer_append(out, " ", 1);
+    writer_append(out, word, strlen(word));
+}
+
+static void build_tile_text(const mapchunk_t *chunk, size_t local,
+    writer_t *out)
+{
+    size_t start = out->len;
+
+    for (int p = 0; p < chunk->occupant_count[local]; p++)
+        append_word(out, "player", start);
+    for (int r = 0; r < RESOURCE_COUNT; r++) {
+        for (int n = chunk->resources[r][local]; n > 0; n--)
+            append_word(out, RESOURCE_NAMES[r], start);
+    }
+}
+
+void append_tile_text(map_t *map, size_t tile, writer_t *out)
+{
+    tilefragment_t *entry = &map->fragments[tile % TILE_FRAGMENT_CACHE];
+    mapchunk_t *chunk = get_chunk(map, tile);
+    size_t local = tile & CHUNK_MASK;
+    size_t start = out->len;
+
+    if (!chunk) {
+        out->failed = true;
+        return;
+    }
+    if (entry->tile == tile && entry->version == chunk->versions[local]) {
+        writer_append(out, entry->text, entry->len);
+        return;
+    }
+    build_tile_text(chunk, local, out);
+    if (out->failed || out->len - start > TILE_FRAGMENT_MAX)
+        return;
+    entry->tile = tile;
+    entry->version = chunk->versions[local];
+    entry->len = out->len - start;
+    memcpy(entry->text, out->data + start, entry->len);
+}
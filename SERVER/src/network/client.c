@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** client.c
+*/
+
+#include "server.h"
+#include "network/client.h"
+#include "network/poll.h"
+
+static int grow_client_table(server_t *server, int fd)
+{
+    int capacity = server->clients_cap ? server->clients_cap : 64;
+    client_t **table;
+
+    while (capacity <= fd)
+        capacity *= 2;
+    table = realloc(server->clients, sizeof(client_t *) * capacity);
+    if (!table)
+        return -1;
+    memset(table + server->clients_cap, 0,
+        sizeof(client_t *) * (capacity - server->clients_cap));
+    server->clients = table;
+    server->clients_cap = capacity;
+    return 0;
+}
+
+client_t *client_create(server_t *server, int fd)
+{
+    client_t *client;
+
+    if (fd >= server->clients_cap && grow_client_table(server, fd) < 0)
+        return NULL;
+    client = calloc(1, sizeof(client_t));
+    if (!client)
+        return NULL;
+    client->fd = fd;
+    client->type = CLIENT_PENDING;
+    client->player = -1;
+    if (poll_add(server, fd, client) < 0) {
+        free(client);
+        return NULL;
+    }
+    server->clients[fd] = client;
+    return client;
+}
+
+client_t *client_get(server_t *server, int fd)
+{
+    if (fd < 0 || fd >= server->clients_cap)
+        return NULL;
+    return server->clients[fd];
+}
+
+void client_drop_output(client_t *client)
+{
+    outchunk_t *next;
+
+    for (outchunk_t *chunk = client->out_head; chunk; chunk = next) {
+        next = chunk->next;
+        outchunk_free(chunk);
+    }
+    client->out_head = NULL;
+    client->out_tail = NULL;
+    client->out_offset = 0;
+    client->out_pending = 0;
+}
+
+void client_destroy(server_t *server, client_t *client)
+{
+    poll_remove(server, client->fd);
+    client_drop_output(client);
+    close(client->fd);
+    server->clients[client->fd] = NULL;
+    free(client);
+}
+
+void client_destroy_all(server_t *server)
+{
+    for (int fd = 0; fd < server->clients_cap; fd++) {
+        if (server->clients[fd])
+            client_destroy(server, server->clients[fd]);
+    }
+    free(server->clients);
+    server->clients = NULL;
+    server->clients_cap = 0;
+}
@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** client_input.c
+*/
+
+#include <string.h>
+#include <sys/socket.h>
+#include "network/client.h"
+
+ssize_t client_read(client_t *client)
+{
+    size_t tail = (client->in_head + client->in_len) & CLIENT_INPUT_MASK;
+    size_t room = CLIENT_INPUT_SIZE - client->in_len;
+    ssize_t received;
+
+    if (room == 0) {
+        client->in_head = 0;
+        client->in_len = 0;
+        client->in_scan = 0;
+        client->in_overflow = true;
+        return client_read(client);
+    }
+    if (tail + room > CLIENT_INPUT_SIZE)
+        room = CLIENT_INPUT_SIZE - tail;
+    received = recv(client->fd, client->in_buf + tail, room, 0);
+    if (received > 0)
+        client->in_len += received;
+    return received;
+}
+
+static bool find_newline(client_t *client, size_t *length)
+{
+    size_t pos;
+
+    for (; client->in_scan < client->in_len; client->in_scan++) {
+        pos = (client->in_head + client->in_scan) & CLIENT_INPUT_MASK;
+        if (client->in_buf[pos] == '\n') {
+            *length = client->in_scan;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void consume_line(client_t *client, char *line, size_t length)
+{
+    size_t first = CLIENT_INPUT_SIZE - client->in_head;
+
+    if (first > length)
+        first = length;
+    memcpy(line, client->in_buf + client->in_head, first);
+    memcpy(line + first, client->in_buf, length - first);
+    if (length > 0 && line[length - 1] == '\r')
+        length--;
+    line[length] = '\0';
+    client->in_head = (client->in_head + client->in_scan + 1)
+        & CLIENT_INPUT_MASK;
+    client->in_len -= client->in_scan + 1;
+    client->in_scan = 0;
+}
+
+bool client_next_line(client_t *client, char *line)
+{
+    size_t length;
+
+    while (find_newline(client, &length)) {
+        consume_line(client, line, length);
+        if (!client->in_overflow)
+            return true;
+        client->in_overflow = false;
+    }
+    return false;
+}
@@ -0,0 +1,176 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** client_output.c
+*/
+
+#include <errno.h>
+#include <sys/uio.h>
+#include "server.h"
+#include "network/client.h"
+#include "network/poll.h"
+#include "network/snapshot.h"
+#include "network/spectator.h"
+
+static outchunk_t *new_chunk(client_t *client, size_t len)
+{
+    size_t cap = len > CLIENT_CHUNK_SIZE || len == 0 ? len :
+        CLIENT_CHUNK_SIZE;
+    outchunk_t *chunk = malloc(sizeof(outchunk_t) + cap);
+
+    if (!chunk)
+        return NULL;
+    chunk->next = NULL;
+    chunk->shared = NULL;
+    chunk->len = 0;
+    chunk->cap = cap;
+    if (client->out_tail)
+        client->out_tail->next = chunk;
+    else
+        client->out_head = chunk;
+    client->out_tail = chunk;
+    return chunk;
+}
+
+void client_mark_dirty(server_t *server, client_t *client)
+{
+    if (client->in_dirty)
+        return;
+    client->in_dirty = true;
+    client->next_dirty = server->dirty_clients;
+    server->dirty_clients = client;
+}
+
+void client_close(server_t *server, client_t *client)
+{
+    client->closing = true;
+    client_mark_dirty(server, client);
+}
+
+static bool can_queue(server_t *server, client_t *client, size_t len)
+{
+    if (client->type == CLIENT_GRAPHIC)
+        spectator_publish(server);
+    if (client->out_pending + len <= CLIENT_OUTPUT_HIGH_WATER)
+        return true;
+    printf("Client %d too slow, disconnecting\n", client->fd);
+    client_drop_output(client);
+    client_close(server, client);
+    return false;
+}
+
+void client_send(server_t *server, int fd, const char *data, size_t len)
+{
+    client_t *client = client_get(server, fd);
+    outchunk_t *tail;
+
+    if (!client || client->closing || len == 0 ||
+        !can_queue(server, client, len))
+        return;
+    tail = client->out_tail;
+    if (!tail || tail->shared || tail->cap - tail->len < len)
+        tail = new_chunk(client, len);
+    if (!tail) {
+        client_close(server, client);
+        return;
+    }
+    memcpy(tail->data + tail->len, data, len);
+    tail->len += len;
+    client->out_pending += len;
+    client_mark_dirty(server, client);
+}
+
+int client_queue_shared(server_t *server, client_t *client,
+    sharedbuf_t *buffer)
+{
+    outchunk_t *chunk = new_chunk(client, 0);
+
+    if (!chunk)
+        return -1;
+    buffer->refs++;
+    chunk->shared = buffer;
+    chunk->len = buffer->len;
+    client->out_pending += buffer->len;
+    client_mark_dirty(server, client);
+    return 0;
+}
+
+void client_send_shared(server_t *server, client_t *client,
+    sharedbuf_t *buffer)
+{
+    if (client->closing || buffer->len == 0)
+        return;
+    if (buffer->len <= CLIENT_SHARE_MIN) {
+        client_send(server, client->fd, buffer->data, buffer->len);
+        return;
+    }
+    if (can_queue(server, client, buffer->len) &&
+        client_queue_shared(server, client, buffer) < 0)
+        client_close(server, client);
+}
+
+static void consume_written(client_t *client, size_t written)
+{
+    outchunk_t *head;
+    size_t available;
+
+    client->out_pending -= written;
+    while (written > 0) {
+        head = client->out_head;
+        available = head->len - client->out_offset;
+        client->out_offset += written < available ? written : available;
+        if (written < available)
+            return;
+        written -= available;
+        client->out_offset = 0;
+        if (head == client->out_tail && !head->shared) {
+            head->len = 0;
+            return;
+        }
+        client->out_head = head->next;
+        client->out_tail = head == client->out_tail ? NULL : client->out_tail;
+        outchunk_free(head);
+    }
+}
+
+static ssize_t write_chunks(client_t *client, size_t *offered)
+{
+    struct iovec iov[CLIENT_IOV_MAX];
+    int count = 0;
+    size_t skip = client->out_offset;
+
+    *offered = 0;
+    for (outchunk_t *chunk = client->out_head; chunk &&
+        count < CLIENT_IOV_MAX; chunk = chunk->next) {
+        iov[count].iov_base = (chunk->shared ? chunk->shared->data :
+            chunk->data) + skip;
+        iov[count].iov_len = chunk->len - skip;
+        *offered += iov[count].iov_len;
+        skip = 0;
+        count++;
+    }
+    return writev(client->fd, iov, count);
+}
+
+int client_flush(server_t *server, client_t *client)
+{
+    ssize_t written = 0;
+    size_t offered = 0;
+
+    snapshot_pump(server, client);
+    while (client->out_pending > 0 && (size_t)written == offered) {
+        written = write_chunks(client, &offered);
+        if (written < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+            return -1;
+        if (written < 0)
+            break;
+        consume_written(client, written);
+        snapshot_pump(server, client);
+    }
+    if ((client->out_pending > 0) != client->out_armed) {
+        client->out_armed = client->out_pending > 0;
+        poll_set_writable(server, client->fd, client, client->out_armed);
+    }
+    return 0;
+}
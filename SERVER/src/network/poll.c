@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** poll.c
+*/
+
+#include <errno.h>
+#include "server.h"
+#include "network/poll.h"
+
+int poll_init(server_t *server)
+{
+    server->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (server->epoll_fd < 0)
+        return -1;
+    return poll_add(server, server->server_socket, NULL);
+}
+
+int poll_add(server_t *server, int fd, void *data)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = data;
+    return epoll_ctl(server->epoll_fd, EPOLL_CTL_ADD, fd, &event);
+}
+
+int poll_set_writable(server_t *server, int fd, void *data, bool writable)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events = writable ? EPOLLIN | EPOLLOUT : EPOLLIN;
+    event.data.ptr = data;
+    return epoll_ctl(server->epoll_fd, EPOLL_CTL_MOD, fd, &event);
+}
+
+void poll_remove(server_t *server, int fd)
+{
+    epoll_ctl(server->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+}
+
+int poll_wait(server_t *server, struct epoll_event *events, int timeout)
+{
+    int count = epoll_wait(server->epoll_fd, events, MAX_EVENTS, timeout);
+
+    if (count < 0 && errno == EINTR)
+        return 0;
+    return count;
+}
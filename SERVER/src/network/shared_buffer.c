@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** shared_buffer.c
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "network/client.h"
+
+static sharedbuf_t *grow_buffer(sharedbuf_t *buffer, size_t needed)
+{
+    size_t cap = buffer ? buffer->cap : SHARED_BUFFER_SIZE;
+    sharedbuf_t *grown;
+
+    while (cap < needed)
+        cap *= 2;
+    grown = realloc(buffer, sizeof(sharedbuf_t) + cap);
+    if (!grown)
+        return NULL;
+    if (!buffer) {
+        grown->refs = 1;
+        grown->len = 0;
+    }
+    grown->cap = cap;
+    return grown;
+}
+
+sharedbuf_t *sharedbuf_create(size_t cap)
+{
+    return grow_buffer(NULL, cap);
+}
+
+int sharedbuf_append(sharedbuf_t **buffer, const char *data, size_t len)
+{
+    sharedbuf_t *current = *buffer;
+    size_t used = current ? current->len : 0;
+
+    if (!current || current->cap - current->len < len) {
+        current = grow_buffer(current, used + len);
+        if (!current)
+            return -1;
+        *buffer = current;
+    }
+    memcpy(current->data + current->len, data, len);
+    current->len += len;
+    return 0;
+}
+
+void sharedbuf_release(sharedbuf_t *buffer)
+{
+    if (buffer && --buffer->refs == 0)
+        free(buffer);
+}
+
+void outchunk_free(outchunk_t *chunk)
+{
+    sharedbuf_release(chunk->shared);
+    free(chunk);
+}
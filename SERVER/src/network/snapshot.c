@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** snapshot.c
+*/
+
+#include "server.h"
+#include "network/client.h"
+#include "network/snapshot.h"
+#include "network/spectator.h"
+#include "utils/format.h"
+
+static int queue_batch(server_t *server, client_t *client)
+{
+    map_t *map = server->map;
+    size_t id = client->snapshot_next;
+    const mapchunk_t *chunk = peek_chunk(map, id);
+    sharedbuf_t *slice = sharedbuf_create(CHUNK_TILES * BCT_LINE_MAX);
+    int status = -1;
+
+    if (chunk && slice) {
+        slice->len = format_chunk(map, id, chunk, slice->data);
+        status = client_queue_shared(server, client, slice);
+    }
+    sharedbuf_release(slice);
+    client->snapshot_next++;
+    return status;
+}
+
+static bool snapshot_active(client_t *client)
+{
+    if (client->snapshot_next < client->snapshot_end)
+        return true;
+    if (client->snapshot_repeats == 0)
+        return false;
+    client->snapshot_repeats--;
+    client->snapshot_next = 0;
+    return true;
+}
+
+void snapshot_pump(server_t *server, client_t *client)
+{
+    if (client->closing || !snapshot_active(client))
+        return;
+    spectator_publish(server);
+    while (client->out_pending < SNAPSHOT_LOW_WATER &&
+        snapshot_active(client)) {
+        if (queue_batch(server, client) < 0) {
+            client_close(server, client);
+            return;
+        }
+    }
+}
+
+void snapshot_start(server_t *server, client_t *client)
+{
+    if (client->snapshot_next < client->snapshot_end) {
+        client->snapshot_repeats++;
+        return;
+    }
+    client->snapshot_next = 0;
+    client->snapshot_end = server->map->chunk_count;
+    snapshot_pump(server, client);
+}
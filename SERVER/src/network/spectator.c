@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** spectator.c
+*/
+
+#include "server.h"
+#include "network/client.h"
+#include "network/spectator.h"
+
+void spectator_add(server_t *server, client_t *client)
+{
+    spectator_publish(server);
+    client->prev_spectator = NULL;
+    client->next_spectator = server->spectators;
+    if (server->spectators)
+        server->spectators->prev_spectator = client;
+    server->spectators = client;
+    server->spectator_count++;
+}
+
+void spectator_remove(server_t *server, client_t *client)
+{
+    if (client->prev_spectator)
+        client->prev_spectator->next_spectator = client->next_spectator;
+    else if (server->spectators == client)
+        server->spectators = client->next_spectator;
+    else
+        return;
+    if (client->next_spectator)
+        client->next_spectator->prev_spectator = client->prev_spectator;
+    client->next_spectator = NULL;
+    client->prev_spectator = NULL;
+    server->spectator_count--;
+}
+
+void spectator_broadcast(server_t *server, const char *data, size_t len)
+{
+    if (!server->spectators || len == 0)
+        return;
+    if (sharedbuf_append(&server->gui_events, data, len) < 0)
+        printf("Dropped GUI event: out of memory\n");
+}
+
+void spectator_publish(server_t *server)
+{
+    sharedbuf_t *events = server->gui_events;
+
+    if (!events)
+        return;
+    server->gui_events = NULL;
+    for (client_t *c = server->spectators; c; c = c->next_spectator)
+        client_send_shared(server, c, events);
+    sharedbuf_release(events);
+}
+
+void spectator_destroy_all(server_t *server)
+{
+    sharedbuf_release(server->gui_events);
+    server->gui_events = NULL;
+    server->spectators = NULL;
+    server->spectator_count = 0;
+}
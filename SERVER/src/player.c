@@ -9,18 +9,17 @@
 #include "server.h"
 #include "map/resource.h"
 #include "command/gui_commands.h"
+#include "time/life.h"
+#include "time/tick.h"
 
-static void set_player_position(player_t *player, server_t *server)
+static void set_player_position(player_t *player, server_t *server,
+    player_init_t *config)
 {
-    tile_t *tile;
-
-    player->x = rand() % server->width;
-    player->y = rand() % server->height;
-    player->orientation = rand() % 4;
+    player->orientation = rng_below(&server->rng, 4);
     player->level = 1;
-    player->action_queue = NULL;
-    tile = get_tile(server->map, player->x, player->y);
-    add_player_to_tile(tile, player);
+    player->actions.head = 0;
+    player->actions.count = 0;
+    place_player(server->map, player, config->x, config->y);
 }
 
 void set_player_resources(player_t *player)
@@ -43,51 +42,79 @@ void init_player(player_t *player, player_init_t config, server_t *server)
     player->team_id = config.team_id;
     strncpy(player->team_name, config.team_name, MAX_TEAM_NAME - 1);
     player->team_name[MAX_TEAM_NAME - 1] = '\0';
-    set_player_position(player, server);
+    set_player_position(player, server, &config);
     set_player_resources(player);
+    player->starve_tick = tick_now(server);
+    feed_player(server, player, player->inventory[FOOD]);
 }
 
 int find_player_by_socket(server_t *server, int socket)
 {
-    for (int i = 0; i < server->num_players; i++) {
-        if (server->players[i].socket == socket) {
-            return i;
-        }
-    }
-    return -1;
+    client_t *client = client_get(server, socket);
+
+    if (!client)
+        return -1;
+    return client->player;
+}
+
+uint64_t get_player_clock(server_t *server, player_t *player)
+{
+    if (player->socket == -1)
+        return player->dormant_tick;
+    return tick_now(server);
+}
+
+void shift_player_ticks(player_t *player, uint64_t delay)
+{
+    action_t *action = action_queue_front(&player->actions);
+
+    player->starve_tick += delay;
+    if (action)
+        action->end_tick += delay;
 }
 
 void remove_player(server_t *server, int player_index)
 {
-    if (server->players[player_index].inventory) {
-        free(server->players[player_index].inventory);
-    }
-    server->teams[server->players[player_index].team_id].current_clients--;
-    for (int i = player_index; i < server->num_players - 1; i++) {
-        server->players[i] = server->players[i + 1];
-    }
-    server->num_players--;
+    player_t *player = &server->players[player_index];
+
+    leave_incantation(server, player);
+    forget_player_level(server, player);
+    remove_player_from_tile(server->map, player);
+    clear_player_actions(server, player);
+    cancel_starvation(server, player);
+    free(player->inventory);
+    player->inventory = NULL;
+    server->teams[player->team_id].current_clients--;
+    if (player->socket == -1)
+        remove_dormant_player(server, player);
+    player_release(server, player);
 }
 
-void send_player_info(server_t *serv, int graphic_fd)
+static void send_one_player_info(server_t *serv, int graphic_fd,
+    player_t *player)
 {
-    player_t *player;
     char buffer[256];
+    int i = get_player_id(player);
 
-    for (int i = 0; i < serv->num_players; i++) {
-        player = &serv->players[i];
-        snprintf(buffer, sizeof(buffer), "pnw #%d %d %d %d %d %s\n", i,
-                player->x, player->y, player->orientation + 1, player->level,
-                serv->teams[player->team_id].name);
-        send(graphic_fd, buffer, strlen(buffer), 0);
-        send_gui_ppo(serv, player->socket);
-        snprintf(buffer, sizeof(buffer), "plv #%d %d\n", i, player->level);
-        send(graphic_fd, buffer, strlen(buffer), 0);
-        snprintf(buffer, sizeof(buffer), "pin #%d %d %d %d %d %d %d %d "
-                "%d %d\n", i, player->x, player->y, player->inventory[FOOD],
-                player->inventory[LINEMATE], player->inventory[DERAUMERE],
-                player->inventory[SIBUR], player->inventory[MENDIANE],
-                player->inventory[PHIRAS], player->inventory[THYSTAME]);
-        send(graphic_fd, buffer, strlen(buffer), 0);
-    }
+    snprintf(buffer, sizeof(buffer), "pnw #%d %d %d %d %d %s\n", i,
+            player->x, player->y, player->orientation + 1, player->level,
+            serv->teams[player->team_id].name);
+    client_send(serv, graphic_fd, buffer, strlen(buffer));
+    handle_gui_ppo(serv, graphic_fd, i);
+    snprintf(buffer, sizeof(buffer), "plv #%d %d\n", i, player->level);
+    client_send(serv, graphic_fd, buffer, strlen(buffer));
+    get_player_food(serv, player);
+    snprintf(buffer, sizeof(buffer), "pin #%d %d %d %d %d %d %d %d "
+            "%d %d\n", i, player->x, player->y, player->inventory[FOOD],
+            player->inventory[LINEMATE], player->inventory[DERAUMERE],
+            player->inventory[SIBUR], player->inventory[MENDIANE],
+            player->inventory[PHIRAS], player->inventory[THYSTAME]);
+    client_send(serv, graphic_fd, buffer, strlen(buffer));
+}
+
+void send_player_info(server_t *serv, int graphic_fd)
+{
+    for (int n = 0; n < serv->num_players; n++)
+        send_one_player_info(serv, graphic_fd,
+            &serv->players[serv->live_players[n]]);
 }
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** player_pool.c
+*/
+
+#include "player.h"
+#include "server.h"
+
+int init_player_pool(server_t *server)
+{
+    server->players = calloc(MAX_CLIENTS, sizeof(player_t));
+    server->live_players = malloc(sizeof(int) * MAX_CLIENTS);
+    server->num_players = 0;
+    server->free_player = -1;
+    if (!server->players || !server->live_players)
+        return -1;
+    for (int slot = MAX_CLIENTS - 1; slot >= 0; slot--) {
+        server->players[slot].slot = slot;
+        server->players[slot].next_free = server->free_player;
+        server->free_player = slot;
+    }
+    return 0;
+}
+
+player_t *player_alloc(server_t *server)
+{
+    player_t *player;
+    unsigned int generation;
+    int slot = server->free_player;
+
+    if (slot == -1)
+        return NULL;
+    player = &server->players[slot];
+    server->free_player = player->next_free;
+    generation = player->generation;
+    memset(player, 0, sizeof(player_t));
+    player->generation = generation;
+    player->slot = slot;
+    player->active = true;
+    player->live_index = server->num_players;
+    server->live_players[server->num_players] = slot;
+    server->num_players++;
+    return player;
+}
+
+void player_release(server_t *server, player_t *player)
+{
+    int last = server->live_players[server->num_players - 1];
+
+    server->live_players[player->live_index] = last;
+    server->players[last].live_index = player->live_index;
+    server->num_players--;
+    player->active = false;
+    player->generation++;
+    player->next_free = server->free_player;
+    server->free_player = player->slot;
+}
+
+int get_player_id(player_t *player)
+{
+    return (int)(player->generation % (INT32_MAX / MAX_CLIENTS))
+        * MAX_CLIENTS + player->slot;
+}
+
+player_t *get_player_by_id(server_t *server, int id)
+{
+    player_t *player;
+
+    if (id < 0)
+        return NULL;
+    player = &server->players[id % MAX_CLIENTS];
+    if (!player->active || get_player_id(player) != id)
+        return NULL;
+    return player;
+}
@@ -5,70 +5,106 @@
 ** server_init
 */
 
+#include <errno.h>
+#include <limits.h>
+#include <getopt.h>
 #include "server.h"
 #include "time/tick.h"
+#include "egg.h"
+#include "checkpoint/checkpoint.h"
+#include "journal/journal.h"
 
-void print_usage(char *program_name)
-{
-    printf("USAGE: %s -p port -x width -y height -n name1 ", program_name);
-    printf("name2 ... -c clientsNb -f freq\n");
-    printf("  -p port      : port number\n");
-    printf("  -x width     : world width\n");
-    printf("  -y height    : world height\n");
-    printf("  -n names     : team names\n");
-    printf("  -c clientsNb : number of authorized clients per team ");
-    printf("at the beginning\n");
-    printf("  -f freq      : reciprocal of time unit ");
-    printf("for execution of actions\n");
-}
+static const char SHORT_OPTIONS[] = "p:x:y:n:c:f:s:h";
+
+static const struct option LONG_OPTIONS[] = {
+    {"restore", required_argument, NULL, 'r'},
+    {"checkpoint", required_argument, NULL, 'k'},
+    {"journal", required_argument, NULL, 'j'},
+    {"replay", required_argument, NULL, 'R'},
+    {"admin-token", required_argument, NULL, 'a'},
+    {NULL, 0, NULL, 0}
+};
 
 static void init_server_defaults(server_t *server)
 {
+    memset(server, 0, sizeof(server_t));
     server->port = 4242;
     server->width = 10;
     server->height = 10;
     server->freq = 100;
+    server->seed = clock_now_ns() ^ ((uint64_t)getpid() << 32);
     server->num_teams = 0;
-    server->graphic_fd = -1;
+    server->winner = -1;
+    server->checkpoint_path = CHECKPOINT_DEFAULT_PATH;
 }
 
-static int handle_parse_port(server_t *server, char *optarg)
+static int parse_bounded(const char *text, long max, int *value)
 {
-    server->port = atoi(optarg);
+    char *end = NULL;
+    long parsed = strtol(text, &end, 10);
+
+    if (*text == '\0' || *end != '\0' || parsed < 1 || parsed > max)
+        return -1;
+    *value = (int)parsed;
+    return 0;
+}
+
+static int parse_seed(const char *text, uint64_t *seed)
+{
+    char *end = NULL;
+    unsigned long long parsed;
+
+    if (*text < '0' || *text > '9')
+        return -1;
+    errno = 0;
+    parsed = strtoull(text, &end, 10);
+    if (errno == ERANGE || *end != '\0')
+        return -1;
+    *seed = parsed;
     return 0;
 }
 
-static int handle_parse_dimensions(server_t *server, char *optarg, char opt)
+static int handle_parse_numbers(server_t *server, char *optarg, char opt)
 {
+    if (opt == 'p')
+        return parse_bounded(optarg, UINT16_MAX, &server->port);
     if (opt == 'x')
-        server->width = atoi(optarg);
+        return parse_bounded(optarg, MAP_SIZE_MAX, &server->width);
     if (opt == 'y')
-        server->height = atoi(optarg);
-    return 0;
+        return parse_bounded(optarg, MAP_SIZE_MAX, &server->height);
+    if (opt == 'f')
+        return parse_bounded(optarg, INT_MAX, &server->freq);
+    return parse_seed(optarg, &server->seed);
 }
 
-static int handle_parse_teams(server_t *server, char *optarg,
-    char **argv)
+static int handle_parse_paths(server_t *server, int opt, char *optarg)
 {
-    parse_team_names(server, optarg, argv);
+    if (opt == 'r')
+        server->restore_path = optarg;
+    if (opt == 'k')
+        server->checkpoint_path = optarg;
+    if (opt == 'j')
+        server->journal_path = optarg;
+    if (opt == 'R')
+        server->replay_path = optarg;
+    if (opt == 'a')
+        server->admin_token = optarg;
     return 0;
 }
 
 static int handle_parse_option(server_t *server, int opt, char *optarg,
     char **argv)
 {
-    if (opt == 'p')
-        return handle_parse_port(server, optarg);
-    if (opt == 'x' || opt == 'y')
-        return handle_parse_dimensions(server, optarg, opt);
-    if (opt == 'n')
-        return handle_parse_teams(server, optarg, argv);
-    if (opt == 'c')
-        return atoi(optarg);
-    if (opt == 'f') {
-        server->freq = atoi(optarg);
+    if (opt == 'p' || opt == 'x' || opt == 'y' || opt == 'f' || opt == 's')
+        return handle_parse_numbers(server, optarg, opt);
+    if (opt == 'n') {
+        parse_team_names(server, optarg, argv);
         return 0;
     }
+    if (opt == 'c')
+        return atoi(optarg);
+    if (opt == 'r' || opt == 'k' || opt == 'j' || opt == 'R' || opt == 'a')
+        return handle_parse_paths(server, opt, optarg);
     if (opt == 'h') {
         print_usage(argv[0]);
         return -2;
@@ -84,19 +120,19 @@ int parse_arguments(int argc, char **argv, server_t *server)
     int result;
 
     init_server_defaults(server);
-    opt = getopt(argc, argv, "p:x:y:n:c:f:h");
+    opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, NULL);
     while (opt != -1) {
         result = handle_parse_option(server, opt, optarg, argv);
-        if (result == -2)
-            return 0;
-        if (result == -1)
-            return -1;
+        if (result < 0)
+            return result == -2 ? 0 : -1;
         if (result > 0)
             clients_nb = result;
-        opt = getopt(argc, argv, "p:x:y:n:c:f:h");
+        opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS,
+            NULL);
     }
     set_team_max_clients(server, clients_nb);
-    if (server->num_teams > 0)
+    if (server->num_teams > 0 || server->restore_path ||
+        server->replay_path)
         return 1;
     return -1;
 }
@@ -136,8 +172,11 @@ int init_server(server_t *server)
         return -1;
     if (bind_server_socket(server) < 0)
         return -1;
-    init_fd_sets(server);
-    print_server_info(server);
-    init_map(server);
+    if (init_event_loop(server) < 0)
+        return -1;
+    if (init_state(server) < 0)
+        return -1;
+    if (server->journal_path)
+        return open_journal(server, server->journal_path);
     return 0;
 }
@@ -7,19 +7,70 @@
 
 #include "server.h"
 #include "time/tick.h"
+#include "network/poll.h"
+#include "checkpoint/checkpoint.h"
+#include "egg.h"
+#include "journal/journal.h"
+#include <signal.h>
 
-void init_fd_sets(server_t *server)
+int init_event_loop(server_t *server)
 {
-    FD_ZERO(&server->master_fds);
-    FD_SET(server->server_socket, &server->master_fds);
-    server->max_fd = server->server_socket;
-    server->num_players = 0;
+    server->clients = NULL;
+    server->clients_cap = 0;
+    return poll_init(server);
+}
+
+int init_world(server_t *server)
+{
+    print_server_info(server);
+    rng_seed(&server->rng, server->seed);
+    if (init_map(server) < 0 || init_eggs(server) < 0)
+        return -1;
+    tick_init(server);
+    return 0;
+}
+
+int init_state(server_t *server)
+{
+    if (heap_init(&server->action_timers, MAX_CLIENTS) < 0 ||
+        heap_init(&server->starvation, MAX_CLIENTS) < 0)
+        return -1;
+    if (init_player_pool(server) < 0)
+        return -1;
+    if (server->restore_path) {
+        if (restore_checkpoint(server, server->restore_path) < 0)
+            return -1;
+    } else if (init_world(server) < 0)
+        return -1;
+    return 0;
+}
+
+void print_usage(char *program_name)
+{
+    printf("USAGE: %s -p port -x width -y height -n name1 ", program_name);
+    printf("name2 ... -c clientsNb -f freq [-s seed]\n");
+    printf("  -p port      : port number\n");
+    printf("  -x width     : world width\n");
+    printf("  -y height    : world height\n");
+    printf("  -n names     : team names\n");
+    printf("  -c clientsNb : number of authorized clients per team ");
+    printf("at the beginning\n");
+    printf("  -f freq      : reciprocal of time unit ");
+    printf("for execution of actions\n");
+    printf("  -s seed      : world generation seed (random by default)\n");
+    printf("  --checkpoint file : checkpoint written on SIGUSR1 or ckp ");
+    printf("(default %s)\n", CHECKPOINT_DEFAULT_PATH);
+    printf("  --restore file    : resume the match saved in a checkpoint\n");
+    printf("  --journal file    : record every command to a journal\n");
+    printf("  --replay file     : re-execute a journal without sockets\n");
+    printf("  --admin-token tok : allow the GUI command ckp tok\n");
 }
 
 void print_server_info(server_t *server)
 {
     printf("Zappy server started on port %d\n", server->port);
     printf("World size: %dx%d\n", server->width, server->height);
+    printf("Seed: %llu\n", (unsigned long long)server->seed);
     printf("Liste des équipes chargées :\n");
     for (int i = 0; i < server->num_teams; i++) {
         printf("  • %s (max_clients = %d)\n",
@@ -30,22 +81,24 @@ void print_server_info(server_t *server)
 
 void run_server(server_t *server)
 {
-    fd_set read_fds;
-    struct timeval timeout;
-    int activity;
+    struct epoll_event events[MAX_EVENTS];
+    int count;
 
-    while (1) {
-        read_fds = server->master_fds;
-        timeout.tv_sec = 0;
-        timeout.tv_usec = 100000;
-        activity = select(server->max_fd + 1, &read_fds, NULL, NULL, &timeout);
-        if (activity < 0)
+    while (server->winner < 0) {
+        count = poll_wait(server, events, tick_timeout(server));
+        if (count < 0)
             break;
-        check_new_connections(server, &read_fds);
-        check_client_messages(server, &read_fds);
+        journal_tick(server, tick_sample(server));
+        for (int i = 0; i < count; i++)
+            handle_poll_event(server, &events[i]);
+        journal_event(server, JOURNAL_STEP, -1);
         process_pending_action(server);
         update_ticks(server);
+        flush_clients(server);
+        process_checkpoint_request(server);
     }
+    if (server->winner >= 0)
+        end_game(server);
 }
 
 int main(int argc, char **argv)
@@ -58,14 +111,14 @@ int main(int argc, char **argv)
         return 0;
     }
     parse_result = parse_arguments(argc, argv, &server);
-    if (parse_result <= 0) {
-        printf("ici\n");
+    if (parse_result <= 0)
         return parse_result == 0 ? 0 : 1;
-    }
-    srand(time(NULL));
-    if (init_server(&server) < 0) {
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGUSR1, request_checkpoint);
+    if (server.replay_path)
+        return replay_journal(&server) < 0 ? 1 : 0;
+    if (init_server(&server) < 0)
         return 1;
-    }
     run_server(&server);
     cleanup_server(&server);
     return 0;
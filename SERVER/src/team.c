@@ -7,6 +7,8 @@
 
 #include "team.h"
 #include "server.h"
+#include "egg.h"
+#include "journal/journal.h"
 
 void add_team_name(server_t *server, const char *name)
 {
@@ -15,6 +17,9 @@ void add_team_name(server_t *server, const char *name)
     strncpy(server->teams[server->num_teams].name, name, MAX_TEAM_NAME - 1);
     server->teams[server->num_teams].name[MAX_TEAM_NAME - 1] = '\0';
     server->teams[server->num_teams].current_clients = 0;
+    server->teams[server->num_teams].max_level_players = 0;
+    server->teams[server->num_teams].dormant = NULL;
+    server->teams[server->num_teams].dormant_count = 0;
     server->num_teams++;
 }
 
@@ -47,26 +52,50 @@ static int can_join_team(server_t *server, int team_id)
 {
     if (team_id == -1)
         return 0;
-    return server->teams[team_id].current_clients
-            < server->teams[team_id].max_clients;
+    return server->teams[team_id].egg_count > 0 ||
+        server->teams[team_id].dormant_count > 0;
+}
+
+static player_t *spawn_player(server_t *server, int client_socket,
+    int team_id, const char *team_name)
+{
+    player_init_t config = {client_socket, team_id, team_name, 0, 0};
+    player_t *player = wake_dormant_player(server, team_id, client_socket);
+    position_t pos;
+
+    if (player)
+        return player;
+    player = player_alloc(server);
+    if (!player)
+        return NULL;
+    if (!hatch_egg(server, team_id, &pos)) {
+        player_release(server, player);
+        return NULL;
+    }
+    config.x = pos.x;
+    config.y = pos.y;
+    init_player(player, config, server);
+    server->teams[team_id].current_clients++;
+    return player;
 }
 
 void handle_team_join_success(server_t *server, int client_socket, int team_id,
     const char *team_name)
 {
-    player_init_t config;
+    client_t *client = client_get(server, client_socket);
+    player_t *player = spawn_player(server, client_socket, team_id,
+        team_name);
 
-    if (server->num_players >= MAX_CLIENTS) {
-        send(client_socket, "ko\n", 3, 0);
+    if (!player) {
+        client_send(server, client_socket, "ko\n", 3);
         return;
     }
-    config.socket = client_socket;
-    config.team_id = team_id;
-    config.team_name = team_name;
-    init_player(&server->players[server->num_players], config, server);
-    server->teams[team_id].current_clients++;
+    if (client) {
+        client->type = CLIENT_AI;
+        client->player = player->slot;
+    }
+    journal_join(server, client_socket, team_id, player->slot);
     send_connection_info(server, client_socket, team_id);
-    server->num_players++;
     printf("Joueur connecté à l'équipe %s\n", team_name);
 }
 
@@ -75,13 +104,13 @@ void handle_team_authentication(server_t *server, int client_socket,
 {
     int team_id = find_team_by_name(server, team_name);
 
-    printf("→ ID %d (clients: %d/%d)\n", team_id, team_id >= 0 ?
+    printf("→ ID %d (clients: %d, eggs: %d)\n", team_id, team_id >= 0 ?
         server->teams[team_id].current_clients : 0,
-            team_id >= 0 ? server->teams[team_id].max_clients : 0);
+            team_id >= 0 ? server->teams[team_id].egg_count : 0);
     if (can_join_team(server, team_id)) {
         handle_team_join_success(server, client_socket, team_id, team_name);
         return;
     }
-    send(client_socket, "ko\n", 3, 0);
+    client_send(server, client_socket, "ko\n", 3);
     printf(team_id == -1 ? "Équipe inconnue\n" : "Équipe pleine\n");
 }
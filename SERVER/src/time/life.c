@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** life.c
+*/
+
+#include "server.h"
+#include "time/life.h"
+#include "time/tick.h"
+#include "map/resource.h"
+#include "command/gui_commands.h"
+
+int get_player_food(server_t *server, player_t *player)
+{
+    uint64_t now = get_player_clock(server, player);
+    uint64_t left = player->starve_tick > now ? player->starve_tick - now : 0;
+
+    player->inventory[FOOD] = (int)((left + FOOD_TICKS - 1) / FOOD_TICKS);
+    return player->inventory[FOOD];
+}
+
+void feed_player(server_t *server, player_t *player, int units)
+{
+    player->starve_tick += (int64_t)units * FOOD_TICKS;
+    heap_set(&server->starvation, player->slot, player->starve_tick);
+    get_player_food(server, player);
+}
+
+void cancel_starvation(server_t *server, player_t *player)
+{
+    heap_remove(&server->starvation, player->slot);
+}
+
+static void starve_player(server_t *server, player_t *player)
+{
+    client_t *client = client_get(server, player->socket);
+
+    printf("Player #%d starved\n", get_player_id(player));
+    player->inventory[FOOD] = 0;
+    clear_player_actions(server, player);
+    client_send(server, player->socket, "dead\n", 5);
+    send_gui_pdi(server, get_player_id(player));
+    if (client)
+        client_close(server, client);
+    else if (player->socket == -1)
+        remove_player(server, player->slot);
+}
+
+void process_starvation(server_t *server)
+{
+    uint64_t now = tick_now(server);
+    int id = heap_pop_due(&server->starvation, now);
+
+    while (id != -1) {
+        starve_player(server, &server->players[id]);
+        id = heap_pop_due(&server->starvation, now);
+    }
+}
+
+uint64_t next_starvation_tick(server_t *server)
+{
+    if (server->starvation.size == 0)
+        return UINT64_MAX;
+    return server->starvation.entries[0].key;
+}
@@ -6,16 +6,111 @@
 */
 
 #include "server.h"
+#include "time/tick.h"
 #include "map/resource.h"
+#include "time/life.h"
+
+uint64_t clock_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * NS_PER_SEC + (uint64_t)now.tv_nsec;
+}
+
+void tick_init(server_t *server)
+{
+    server->tick_origin_ns = clock_now_ns();
+    server->tick_origin = 0;
+    server->tick_count = 0;
+    server->next_respawn_tick = RESPAWN_INTERVAL;
+    server->last_dirty_flush = 0;
+}
+
+void tick_resume(server_t *server, uint64_t tick)
+{
+    tick_init(server);
+    server->tick_origin = tick;
+    server->tick_count = tick;
+    server->last_dirty_flush = tick;
+}
+
+uint64_t tick_sample(server_t *server)
+{
+    uint64_t elapsed = clock_now_ns() - server->tick_origin_ns;
+    uint64_t freq = server->freq;
+
+    server->tick_count = server->tick_origin + elapsed / NS_PER_SEC * freq
+        + elapsed % NS_PER_SEC * freq / NS_PER_SEC;
+    return server->tick_count;
+}
+
+uint64_t tick_now(server_t *server)
+{
+    return server->tick_count;
+}
+
+static uint64_t tick_deadline_ns(server_t *server, uint64_t tick)
+{
+    uint64_t ticks = tick - server->tick_origin;
+    uint64_t freq = server->freq;
+
+    return server->tick_origin_ns + ticks / freq * NS_PER_SEC
+        + (ticks % freq * NS_PER_SEC + freq - 1) / freq;
+}
+
+void tick_set_freq(server_t *server, int freq)
+{
+    uint64_t tick = tick_now(server);
+
+    server->tick_origin_ns = tick_deadline_ns(server, tick);
+    server->tick_origin = tick;
+    server->freq = freq;
+}
+
+static uint64_t get_next_tick(server_t *server)
+{
+    uint64_t next_tick = next_action_tick(server);
+
+    if (next_starvation_tick(server) < next_tick)
+        next_tick = next_starvation_tick(server);
+    if (server->next_respawn_tick < next_tick)
+        next_tick = server->next_respawn_tick;
+    if (server->map->dirty_count > 0 &&
+        server->last_dirty_flush + 1 < next_tick)
+        next_tick = server->last_dirty_flush + 1;
+    return next_tick;
+}
+
+int tick_timeout(server_t *server)
+{
+    uint64_t next_tick = get_next_tick(server);
+    uint64_t deadline;
+    uint64_t now;
+
+    if (next_tick <= tick_sample(server))
+        return 0;
+    deadline = tick_deadline_ns(server, next_tick);
+    now = clock_now_ns();
+    if (deadline <= now)
+        return 0;
+    if (deadline - now > MAX_POLL_TIMEOUT_MS * NS_PER_MS)
+        return MAX_POLL_TIMEOUT_MS;
+    return (int)((deadline - now + NS_PER_MS - 1) / NS_PER_MS);
+}
 
 void update_ticks(server_t *server)
 {
-    time_t now = time(NULL);
+    uint64_t now = tick_now(server);
 
-    if (now - server->last_tick >= 1) {
-        server->last_tick = now;
-        server->tick_count += 1;
-        if (server->tick_count % 20 == 0)
-            respawn_resource(server->map);
+    process_starvation(server);
+    if (now >= server->next_respawn_tick) {
+        respawn_resource(server->map, &server->rng);
+        server->next_respawn_tick = now - now % RESPAWN_INTERVAL
+            + RESPAWN_INTERVAL;
+    }
+    if (server->map->dirty_count > 0 && now > server->last_dirty_flush) {
+        flush_dirty_tiles(server);
+        server->last_dirty_flush = now;
     }
 }
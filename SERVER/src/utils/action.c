@@ -9,87 +9,98 @@
 #include "player.h"
 #include "server.h"
 #include "command/command.h"
+#include "time/tick.h"
+#include "utils/heap.h"
+#include "journal/journal.h"
 
-static void add_action(player_t *player, time_t base_time,
-    action_t *new_action, int freq)
+void add_action_to_queue(server_t *server, player_t *player,
+    const char *command)
 {
-    action_t *curr;
-    int duration_ticks = get_command_duration(new_action->command);
+    actionqueue_t *queue = &player->actions;
+    const char *arg;
+    opcode_t opcode = parse_command(command, &arg);
+    action_t *new_action;
 
-    if (player->action_queue == NULL) {
-        new_action->end_time = base_time +
-            (int)ceil((double)duration_ticks / freq);
-        new_action->next = NULL;
-        player->action_queue = new_action;
-    } else {
-        curr = player->action_queue;
-        while (curr->next)
-            curr = curr->next;
-        new_action->end_time = curr->end_time +
-            (int)ceil((double)duration_ticks / freq);
-        new_action->next = NULL;
-        curr->next = new_action;
+    journal_text(server, JOURNAL_COMMAND, player->slot, command);
+    new_action = action_queue_push(queue, opcode, arg);
+    if (!new_action)
+        return;
+    new_action->duration = get_command_duration(opcode);
+    if (queue->count == 1) {
+        new_action->end_tick = tick_now(server) + new_action->duration;
+        heap_set(&server->action_timers, player->slot,
+            new_action->end_tick);
     }
 }
 
-void add_action_to_queue(player_t *player, const char *command, int freq)
+void clear_player_actions(server_t *server, player_t *player)
 {
-    action_t *new_action = malloc(sizeof(action_t));
-    time_t base_time;
-    int duration_ticks = get_command_duration(command);
-
-    if (!new_action)
-        return;
-    base_time = time(NULL);
-    strncpy(new_action->command, command, sizeof(new_action->command) - 1);
-    new_action->command[sizeof(new_action->command) - 1] = '\0';
-    add_action(player, base_time, new_action, freq);
-    new_action->duration = duration_ticks;
+    heap_remove(&server->action_timers, player->slot);
+    while (player->actions.count > 0)
+        action_queue_pop(&player->actions);
 }
 
-void next_action(action_t **action_queue)
+void continue_action(player_t *player, int opcode)
 {
-    action_t *to_remove = NULL;
+    action_t *action = action_queue_front(&player->actions);
 
-    if (!action_queue || !*action_queue)
+    if (action == NULL)
         return;
-    to_remove = *action_queue;
-    *action_queue = to_remove->next;
-    free(to_remove);
+    action->opcode = opcode;
+    action->duration = get_command_duration(opcode);
+    action->end_tick += action->duration;
 }
 
-void verif_incantation(player_t *player, server_t *server, action_t
-    *current_action)
+static void schedule_next_action(server_t *server, player_t *player,
+    uint64_t previous_end)
 {
-    if (player->is_incanting == true)
-        finish_incantation(player, server);
-    else
-        process_player_command(player, server, current_action->command);
+    action_t *next;
+
+    action_queue_pop(&player->actions);
+    next = action_queue_front(&player->actions);
+    if (next == NULL)
+        return;
+    next->end_tick = previous_end + next->duration;
+    heap_set(&server->action_timers, player->slot, next->end_tick);
 }
 
 static void handle_action(server_t *server, int i)
 {
     player_t *player = &server->players[i];
-    action_t *current_action = NULL;
-    time_t now;
+    action_t *action = action_queue_front(&player->actions);
+    uint64_t end_tick;
+    int opcode;
 
-    if (player->action_queue == NULL)
+    if (action == NULL)
+        return;
+    end_tick = action->end_tick;
+    opcode = action->opcode;
+    process_player_command(player, server, opcode,
+        action_payload(&player->actions, action));
+    action = action_queue_front(&player->actions);
+    if (action == NULL)
+        return;
+    if (action->opcode != opcode) {
+        heap_set(&server->action_timers, i, action->end_tick);
         return;
-    current_action = player->action_queue;
-    now = time(NULL);
-    if (now >= current_action->end_time) {
-        printf("handle action %s\n", current_action->command);
-        if (strcmp(current_action->command, "Incantation") == 0) {
-            verif_incantation(player, server, current_action);
-        } else {
-            process_player_command(player, server, current_action->command);
-        }
-        next_action(&player->action_queue);
     }
+    schedule_next_action(server, player, end_tick);
 }
 
 void process_pending_action(server_t *server)
 {
-    for (int i = 0; i < server->num_players; i++)
-        handle_action(server, i);
+    uint64_t now = tick_now(server);
+    int id = heap_pop_due(&server->action_timers, now);
+
+    while (id != -1) {
+        handle_action(server, id);
+        id = heap_pop_due(&server->action_timers, now);
+    }
+}
+
+uint64_t next_action_tick(server_t *server)
+{
+    if (server->action_timers.size == 0)
+        return UINT64_MAX;
+    return server->action_timers.entries[0].key;
 }
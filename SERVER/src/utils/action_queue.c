@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** action_queue.c
+*/
+
+#include <string.h>
+#include "utils/action.h"
+
+static int arena_alloc(actionqueue_t *queue, size_t length)
+{
+    size_t head;
+    size_t tail = queue->arena_tail;
+
+    if (queue->count == 0)
+        return length <= ACTION_ARENA_SIZE ? 0 : -1;
+    head = queue->slots[queue->head].offset;
+    if (tail > head) {
+        if (tail + length <= ACTION_ARENA_SIZE)
+            return (int)tail;
+        return length <= head ? 0 : -1;
+    }
+    if (tail + length <= head)
+        return (int)tail;
+    return -1;
+}
+
+action_t *action_queue_push(actionqueue_t *queue, int opcode,
+    const char *arg)
+{
+    size_t length = strlen(arg) + 1;
+    int offset;
+    action_t *action;
+
+    if (queue->count >= ACTION_QUEUE_SIZE)
+        return NULL;
+    offset = arena_alloc(queue, length);
+    if (offset < 0)
+        return NULL;
+    memcpy(queue->arena + offset, arg, length);
+    queue->arena_tail = offset + length;
+    action = &queue->slots[(queue->head + queue->count) & ACTION_QUEUE_MASK];
+    action->opcode = opcode;
+    action->offset = offset;
+    action->length = length - 1;
+    queue->count++;
+    return action;
+}
+
+action_t *action_queue_front(actionqueue_t *queue)
+{
+    if (queue->count == 0)
+        return NULL;
+    return &queue->slots[queue->head];
+}
+
+action_t *action_queue_back(actionqueue_t *queue)
+{
+    if (queue->count == 0)
+        return NULL;
+    return &queue->slots[(queue->head + queue->count - 1)
+        & ACTION_QUEUE_MASK];
+}
+
+void action_queue_pop(actionqueue_t *queue)
+{
+    if (queue->count == 0)
+        return;
+    queue->head = (queue->head + 1) & ACTION_QUEUE_MASK;
+    queue->count--;
+    if (queue->count == 0)
+        queue->arena_tail = 0;
+}
+
+const char *action_payload(actionqueue_t *queue, action_t *action)
+{
+    return queue->arena + action->offset;
+}
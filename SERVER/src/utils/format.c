@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** format.c
+*/
+
+#include <string.h>
+#include "utils/format.h"
+#include "map/resource.h"
+
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233"
+    "34353637383940414243444546474849505152535455565758596061626364656667"
+    "6869707172737475767778798081828384858687888990919293949596979899";
+
+size_t format_uint(char *buffer, unsigned int value)
+{
+    char digits[UINT_DIGITS_MAX];
+    size_t pos = UINT_DIGITS_MAX;
+    size_t len;
+
+    while (value >= 100) {
+        pos -= 2;
+        memcpy(digits + pos, DIGIT_PAIRS + (value % 100) * 2, 2);
+        value /= 100;
+    }
+    if (value >= 10) {
+        pos -= 2;
+        memcpy(digits + pos, DIGIT_PAIRS + value * 2, 2);
+    } else
+        digits[--pos] = '0' + value;
+    len = UINT_DIGITS_MAX - pos;
+    memcpy(buffer, digits + pos, len);
+    return len;
+}
+
+size_t format_bct(char *buffer, const mapchunk_t *chunk, int x, int y)
+{
+    size_t local = ((y & (CHUNK_SIZE - 1)) << CHUNK_SHIFT) |
+        (x & (CHUNK_SIZE - 1));
+    size_t len = 4;
+
+    memcpy(buffer, "bct ", 4);
+    len += format_uint(buffer + len, x);
+    buffer[len++] = ' ';
+    len += format_uint(buffer + len, y);
+    for (int i = 0; i < RESOURCE_COUNT; i++) {
+        buffer[len++] = ' ';
+        len += format_uint(buffer + len, chunk->resources[i][local]);
+    }
+    buffer[len++] = '\n';
+    return len;
+}
+
+size_t format_chunk(map_t *map, size_t chunk_id,
+    const mapchunk_t *chunk, char *buffer)
+{
+    int cx = (int)(chunk_id % map->chunks_w) << CHUNK_SHIFT;
+    int cy = (int)(chunk_id / map->chunks_w) << CHUNK_SHIFT;
+    int width;
+    int height;
+    size_t len = 0;
+
+    get_chunk_extent(map, chunk_id, &width, &height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+            len += format_bct(buffer + len, chunk, cx + x, cy + y);
+    return len;
+}
@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** heap.c
+*/
+
+#include <stdlib.h>
+#include "utils/heap.h"
+
+static bool entry_before(heapentry_t *a, heapentry_t *b)
+{
+    if (a->key != b->key)
+        return a->key < b->key;
+    return a->seq < b->seq;
+}
+
+static void swap_entries(heap_t *heap, int a, int b)
+{
+    heapentry_t tmp = heap->entries[a];
+
+    heap->entries[a] = heap->entries[b];
+    heap->entries[b] = tmp;
+    heap->positions[heap->entries[a].id] = a;
+    heap->positions[heap->entries[b].id] = b;
+}
+
+static void sift(heap_t *heap, int pos)
+{
+    int child;
+
+    while (pos > 0 && entry_before(&heap->entries[pos],
+        &heap->entries[(pos - 1) / 2])) {
+        swap_entries(heap, pos, (pos - 1) / 2);
+        pos = (pos - 1) / 2;
+    }
+    while (2 * pos + 1 < heap->size) {
+        child = 2 * pos + 1;
+        if (child + 1 < heap->size && entry_before(&heap->entries[child + 1],
+            &heap->entries[child]))
+            child++;
+        if (!entry_before(&heap->entries[child], &heap->entries[pos]))
+            return;
+        swap_entries(heap, pos, child);
+        pos = child;
+    }
+}
+
+int heap_init(heap_t *heap, int capacity)
+{
+    heap->entries = malloc(sizeof(heapentry_t) * capacity);
+    heap->positions = malloc(sizeof(int) * capacity);
+    heap->size = 0;
+    heap->capacity = capacity;
+    heap->next_seq = 0;
+    if (!heap->entries || !heap->positions)
+        return -1;
+    for (int i = 0; i < capacity; i++)
+        heap->positions[i] = -1;
+    return 0;
+}
+
+void heap_destroy(heap_t *heap)
+{
+    free(heap->entries);
+    free(heap->positions);
+    heap->entries = NULL;
+    heap->positions = NULL;
+    heap->size = 0;
+}
+
+void heap_set(heap_t *heap, int id, uint64_t key)
+{
+    int pos = heap->positions[id];
+
+    if (pos == -1) {
+        pos = heap->size;
+        heap->size++;
+        heap->positions[id] = pos;
+        heap->entries[pos].id = id;
+    }
+    heap->entries[pos].key = key;
+    heap->entries[pos].seq = heap->next_seq;
+    heap->next_seq++;
+    sift(heap, pos);
+}
+
+void heap_remove(heap_t *heap, int id)
+{
+    int pos = heap->positions[id];
+
+    if (pos == -1)
+        return;
+    heap->size--;
+    if (pos != heap->size) {
+        swap_entries(heap, pos, heap->size);
+        heap->positions[id] = -1;
+        sift(heap, pos);
+        return;
+    }
+    heap->positions[id] = -1;
+}
+
+int heap_pop_due(heap_t *heap, uint64_t now)
+{
+    int id;
+
+    if (heap->size == 0 || heap->entries[0].key > now)
+        return -1;
+    id = heap->entries[0].id;
+    heap_remove(heap, id);
+    return id;
+}
@@ -0,0 +1,35 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** mapped_file.c
+*/
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "utils/mapped_file.h"
+
+const void *map_file(const char *path, size_t *size)
+{
+    struct stat info;
+    int fd = open(path, O_RDONLY);
+    void *data;
+
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &info) < 0 || info.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    *size = (size_t)info.st_size;
+    data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    return data == MAP_FAILED ? NULL : data;
+}
+
+void unmap_file(const void *data, size_t size)
+{
+    munmap((void *)data, size);
+}
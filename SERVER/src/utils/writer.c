@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** writer.c
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "utils/writer.h"
+
+char *writer_reserve(writer_t *writer, size_t len)
+{
+    size_t cap = writer->cap ? writer->cap : WRITER_INITIAL_SIZE;
+    char *grown;
+
+    if (writer->failed)
+        return NULL;
+    if (writer->cap - writer->len >= len)
+        return writer->data + writer->len;
+    while (cap - writer->len < len)
+        cap *= 2;
+    grown = realloc(writer->data, cap);
+    if (!grown) {
+        writer->failed = true;
+        return NULL;
+    }
+    writer->data = grown;
+    writer->cap = cap;
+    return writer->data + writer->len;
+}
+
+void writer_append(writer_t *writer, const char *data, size_t len)
+{
+    char *dst;
+
+    if (len == 0)
+        return;
+    dst = writer_reserve(writer, len);
+    if (!dst)
+        return;
+    memcpy(dst, data, len);
+    writer->len += len;
+}
+
+void writer_reset(writer_t *writer)
+{
+    writer->len = 0;
+    writer->failed = false;
+}
+
+void writer_free(writer_t *writer)
+{
+    free(writer->data);
+    writer->data = NULL;
+    writer->len = 0;
+    writer->cap = 0;
+}
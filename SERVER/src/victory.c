@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** B-YEP-400-LIL-4-1-zappy-thibault.pouch
+** File description:
+** victory.c
+*/
+
+#include <poll.h>
+#include "server.h"
+#include "team.h"
+#include "player.h"
+#include "command/gui_commands.h"
+#include "time/tick.h"
+
+void raise_player_level(server_t *server, player_t *player)
+{
+    team_t *team = &server->teams[player->team_id];
+
+    set_player_level(server->map, player, player->level + 1);
+    if (player->level != LEVEL_MAX)
+        return;
+    team->max_level_players++;
+    if (team->max_level_players >= WIN_PLAYERS && server->winner < 0)
+        server->winner = player->team_id;
+}
+
+void forget_player_level(server_t *server, player_t *player)
+{
+    if (player->level == LEVEL_MAX)
+        server->teams[player->team_id].max_level_players--;
+}
+
+static nfds_t collect_writers(server_t *server, struct pollfd *fds)
+{
+    nfds_t count = 0;
+    client_t *client;
+
+    for (int fd = 0; fd < server->clients_cap; fd++) {
+        client = server->clients[fd];
+        if (!client || client->out_pending == 0)
+            continue;
+        fds[count].fd = fd;
+        fds[count].events = POLLOUT;
+        fds[count].revents = 0;
+        count++;
+    }
+    return count;
+}
+
+static void drain_clients(server_t *server)
+{
+    struct pollfd *fds = malloc(sizeof(struct pollfd) * server->clients_cap);
+    uint64_t now = clock_now_ns();
+    uint64_t deadline = now + END_DRAIN_TIMEOUT_MS * NS_PER_MS;
+    nfds_t count;
+
+    flush_clients(server);
+    while (fds && now < deadline) {
+        count = collect_writers(server, fds);
+        if (count == 0 ||
+            poll(fds, count, (deadline - now) / NS_PER_MS + 1) < 0)
+            break;
+        for (nfds_t i = 0; i < count; i++)
+            if (fds[i].revents)
+                client_mark_dirty(server, server->clients[fds[i].fd]);
+        flush_clients(server);
+        now = clock_now_ns();
+    }
+    free(fds);
+}
+
+void end_game(server_t *server)
+{
+    const char *name = server->teams[server->winner].name;
+
+    printf("Team %s won the game\n", name);
+    send_gui_seg(server, name);
+    for (int i = 0; i < server->num_players; i++)
+        client_send(server, server->players[server->live_players[i]].socket,
+            "dead\n", 5);
+    drain_clients(server);
+}